@@ -4,25 +4,62 @@
 #include <string>
 #include <memory>
 #include <unordered_map>
+#include <list>
+#include <vector>
+#include <mutex>
+#include <chrono>
 #include "../mapping/IEntity.h"
 #include "../utils/logger/Logger.h"
 
+// 2차 캐시 설정
+struct CacheConfig {
+    size_t shardCount = 16;                  // 키 해시로 선택되는 잠금 단위 수
+    size_t maxEntries = 10000;               // 전체 엔트리 한도 (0이면 무제한)
+    std::chrono::milliseconds defaultTTL{0}; // 0이면 만료 없음
+    std::unordered_map<std::string, std::chrono::milliseconds> entityTTL; // 엔티티 이름별 TTL
+};
+
+// 샤드 단위로 잠금을 나눈 LRU 2차 캐시. 서로 다른 샤드의 접근은 경합하지 않습니다.
 class CacheManager {
 public:
     static CacheManager& getInstance();
 
+    // 캐시를 다시 구성합니다. 기존 엔트리는 모두 제거되며, 동시 사용 전에 호출해야 합니다.
+    void configure(const CacheConfig& config);
+
     void put(const std::string& key, const std::shared_ptr<IEntity>& entity);
     std::shared_ptr<IEntity> get(const std::string& key);
     void remove(const std::string& key);
     void clear();
 
+    size_t size() const;
+
 private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        std::string key;
+        std::shared_ptr<IEntity> entity;
+        Clock::time_point expiresAt; // time_point::max()이면 만료 없음
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::list<Entry> lru; // 앞쪽이 가장 최근에 사용된 엔트리
+        std::unordered_map<std::string, std::list<Entry>::iterator> index;
+        size_t capacity = 0;  // 0이면 무제한
+    };
+
     CacheManager();
     CacheManager(const CacheManager&) = delete;
     CacheManager& operator=(const CacheManager&) = delete;
 
-    std::unordered_map<std::string, std::shared_ptr<IEntity>> cache;
+    Shard& shardFor(const std::string& key);
+    Clock::time_point expiryFor(const std::string& entityName) const;
+
+    CacheConfig config;
+    std::vector<std::unique_ptr<Shard>> shards;
     Logger& logger;
 };
 
-#endif // CACHE_MANAGER_H
\ No newline at end of file
+#endif // CACHE_MANAGER_H
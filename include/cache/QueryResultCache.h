@@ -0,0 +1,71 @@
+#ifndef QUERY_RESULT_CACHE_H
+#define QUERY_RESULT_CACHE_H
+
+#include <string>
+#include <memory>
+#include <unordered_map>
+#include <list>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+#include "../database/ResultSet.h"
+#include "../database/SQLParameter.h"
+#include "../query/MappingPlan.h"
+#include "../utils/logger/Logger.h"
+
+// 캐시된 쿼리 결과. plan은 엔티티 목록(list) 결과에만 존재합니다.
+struct CachedQueryResult {
+    std::shared_ptr<const ResultSet> rows;
+    std::shared_ptr<const MappingPlan> plan;
+};
+
+// (테이블 키, 버전) 목록. 엔트리를 저장할 때의 테이블 버전입니다.
+using TableVersions = std::vector<std::pair<std::string, uint64_t>>;
+
+// 정규화된 SQL과 바인딩 값을 키로 하는 쿼리 결과 LRU 캐시.
+// 엔트리는 읽은 테이블의 버전을 함께 기록하며, 조회 시 TableVersionRegistry의 현재 버전과
+// 하나라도 다르면 무효로 간주하고 제거합니다.
+class QueryResultCache {
+public:
+    static constexpr size_t DEFAULT_MAX_ENTRIES = 256;
+
+    static QueryResultCache& getInstance();
+
+    // 최대 엔트리 수를 설정합니다. (0이면 캐시 비활성화)
+    void setMaxEntries(size_t maxEntries);
+
+    // 공백을 정리하고 끝의 ';'를 제거한 SQL (따옴표 안은 그대로 유지)
+    static std::string normalizeSQL(const std::string& sql);
+    // 결과 종류, 데이터베이스, 정규화된 SQL, 이름순으로 정렬한 파라미터로 키를 만듭니다.
+    static std::string makeKey(const std::string& kind, const std::string& database, const std::string& sql,
+                               const std::unordered_map<std::string, SQLParameter>& parameters);
+    // 테이블들의 현재 버전을 기록합니다. 쿼리 실행 전에 호출해야 합니다.
+    static TableVersions captureVersions(const std::vector<std::string>& tableKeys);
+
+    std::shared_ptr<const CachedQueryResult> get(const std::string& key);
+    void put(const std::string& key, TableVersions versions, std::shared_ptr<const CachedQueryResult> result);
+    void clear();
+
+    size_t size() const;
+
+private:
+    struct Entry {
+        std::string key;
+        TableVersions versions;
+        std::shared_ptr<const CachedQueryResult> result;
+    };
+
+    QueryResultCache();
+    QueryResultCache(const QueryResultCache&) = delete;
+    QueryResultCache& operator=(const QueryResultCache&) = delete;
+
+    static bool isCurrent(const TableVersions& versions);
+
+    mutable std::mutex mutex;
+    std::list<Entry> lru; // 앞쪽이 가장 최근에 사용된 엔트리
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    size_t maxEntries;
+    Logger& logger;
+};
+
+#endif // QUERY_RESULT_CACHE_H
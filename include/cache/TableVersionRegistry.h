@@ -0,0 +1,30 @@
+#ifndef TABLE_VERSION_REGISTRY_H
+#define TABLE_VERSION_REGISTRY_H
+
+#include <string>
+#include <unordered_map>
+#include <shared_mutex>
+#include <cstdint>
+
+// 테이블별 변경 버전 카운터. 연결의 커밋 훅이 변경된 테이블의 버전을 올리고,
+// 쿼리 결과 캐시는 저장 당시의 버전과 비교하여 엔트리의 유효성을 판단합니다.
+class TableVersionRegistry {
+public:
+    static TableVersionRegistry& getInstance();
+
+    // 데이터베이스 파일과 테이블 이름으로 키를 만듭니다.
+    static std::string makeKey(const std::string& database, const std::string& table);
+
+    uint64_t getVersion(const std::string& tableKey) const;
+    void bump(const std::string& tableKey);
+
+private:
+    TableVersionRegistry() = default;
+    TableVersionRegistry(const TableVersionRegistry&) = delete;
+    TableVersionRegistry& operator=(const TableVersionRegistry&) = delete;
+
+    mutable std::shared_mutex mutex;
+    std::unordered_map<std::string, uint64_t> versions;
+};
+
+#endif // TABLE_VERSION_REGISTRY_H
@@ -1,32 +1,66 @@
 #ifndef CONNECTION_POOL_H
 #define CONNECTION_POOL_H
 
-#include <queue>
+#include <deque>
+#include <vector>
 #include <mutex>
 #include <condition_variable>
 #include <memory>
 #include <chrono>
 #include "IDatabaseConnection.h"
 #include "DatabaseConfig.h"
+#include "utils/logger/Logger.h"
 
+// 연결 풀 상태 (모니터링용)
+struct ConnectionPoolStats {
+    size_t totalConnections; // 열린 연결 + 여는 중인 연결
+    size_t idleConnections;
+    size_t waitingThreads;
+    std::chrono::microseconds averageWait; // 최근 획득 대기 시간의 지수 이동 평균
+};
+
+// 최소 크기만큼 미리 연결을 열고, 대기 시간에 따라 최대 크기까지 늘리는 연결 풀.
+// 연결을 열고 닫는 작업은 잠금 밖에서 수행하여 다른 획득/반납을 막지 않습니다.
 class ConnectionPool {
 public:
-    ConnectionPool(const DatabaseConfig& config, size_t initialSize, size_t maxSize);
+    ConnectionPool(const DatabaseConfig& config, size_t minSize, size_t maxSize);
     ~ConnectionPool();
 
     std::shared_ptr<IDatabaseConnection> acquireConnection();
     void releaseConnection(std::shared_ptr<IDatabaseConnection> connection);
 
+    ConnectionPoolStats getStats() const;
+
 private:
-    void createInitialConnections();
+    using Clock = std::chrono::steady_clock;
+
+    struct IdleConnection {
+        std::shared_ptr<IDatabaseConnection> connection;
+        Clock::time_point idleSince;
+    };
+
+    // 평균 대기 시간이 이보다 짧으면 새 연결을 열기 전에 반납을 잠시 기다립니다.
+    static constexpr std::chrono::milliseconds GROWTH_WAIT_THRESHOLD{5};
+
     std::shared_ptr<IDatabaseConnection> createNewConnection();
+    // 최소 크기를 넘는 오래된 유휴 연결을 꺼냅니다. (poolMutex 보유 상태에서 호출)
+    void collectIdleConnections(std::vector<std::shared_ptr<IDatabaseConnection>>& expired);
+    void recordWait(Clock::duration wait);
+    void discardConnection(const std::shared_ptr<IDatabaseConnection>& connection);
 
     DatabaseConfig config;
+    size_t minPoolSize;
     size_t maxPoolSize;
-    std::queue<std::shared_ptr<IDatabaseConnection>> connections;
-    std::mutex poolMutex;
+    std::chrono::milliseconds connectionTimeout;
+    std::chrono::milliseconds idleTimeout;
+    Logger& logger;
+
+    std::deque<IdleConnection> connections; // 뒤쪽이 가장 최근에 반납된 연결
+    mutable std::mutex poolMutex;
     std::condition_variable condition;
-    size_t currentPoolSize;
+    size_t currentPoolSize; // 여는 중인 연결 포함
+    size_t waitingThreads;
+    std::chrono::microseconds averageWait;
 };
 
 #endif // CONNECTION_POOL_H
@@ -0,0 +1,161 @@
+#ifndef ASYNC_EXECUTOR_H
+#define ASYNC_EXECUTOR_H
+
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include "utils/logger/Logger.h"
+
+// 데이터베이스 작업을 실행하는 고정 크기 작업자 풀.
+// 대기열이 가득 차면 작업을 넣는 스레드를 막아 생산 속도를 작업자 처리 속도에 맞춥니다. (backpressure)
+class AsyncExecutor {
+public:
+    static AsyncExecutor& getInstance();
+
+    // 작업자 수와 대기열 크기를 설정합니다. 이미 대기 중인 작업을 모두 실행한 뒤 작업자를 교체합니다.
+    void configure(size_t workerCount, size_t queueCapacity);
+
+    void post(std::function<void()> task);
+
+    template <typename F>
+    auto submit(F&& work) -> std::future<std::invoke_result_t<std::decay_t<F>&>> {
+        using Result = std::invoke_result_t<std::decay_t<F>&>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(work));
+        auto future = task->get_future();
+        post([task]() { (*task)(); });
+        return future;
+    }
+
+    size_t getWorkerCount() const;
+    size_t getQueueCapacity() const;
+
+private:
+    AsyncExecutor();
+    ~AsyncExecutor();
+    AsyncExecutor(const AsyncExecutor&) = delete;
+    AsyncExecutor& operator=(const AsyncExecutor&) = delete;
+
+    void start(size_t workerCount, size_t queueCapacity);
+    void stop();
+    void workerLoop();
+
+    mutable std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    std::deque<std::function<void()>> tasks;
+    std::vector<std::thread> workers;
+    size_t queueCapacity;
+    bool stopping;
+    Logger& logger;
+};
+
+// 작업을 제출 순서대로 하나씩 실행하는 직렬 실행기. (세션처럼 동시 사용이 안 되는 대상용)
+// 실제 실행은 AsyncExecutor의 작업자가 담당하며, 한 번에 한 작업자만 이 실행기의 작업을 처리합니다.
+class AsyncStrand : public std::enable_shared_from_this<AsyncStrand> {
+public:
+    // capacity개의 작업이 대기 중이면 post()가 자리가 날 때까지 기다립니다.
+    explicit AsyncStrand(size_t capacity);
+
+    void post(std::function<void()> task);
+
+    template <typename F>
+    auto submit(F&& work) -> std::future<std::invoke_result_t<std::decay_t<F>&>> {
+        using Result = std::invoke_result_t<std::decay_t<F>&>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(work));
+        auto future = task->get_future();
+        post([task]() { (*task)(); });
+        return future;
+    }
+
+    // 대기 중인 작업이 모두 끝날 때까지 기다립니다. (이 실행기의 작업 안에서 호출하면 안 됩니다)
+    void waitIdle();
+
+private:
+    void drain();
+
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::deque<std::function<void()>> pending;
+    size_t capacity;
+    bool running;
+};
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+#include <coroutine>
+
+// co_await 하면 작업을 AsyncStrand에서 실행하고, 끝나면 AsyncExecutor의 작업자에서 코루틴을 재개합니다.
+// 실행기 작업 안에서 재개하면 코루틴이 세션을 닫을 때 waitIdle()이 자기 자신을 기다리게 되므로,
+// 재개는 실행기 작업이 끝난 뒤 별도 작업으로 합니다.
+template <typename T>
+class AsyncAwaitable {
+public:
+    AsyncAwaitable(std::shared_ptr<AsyncStrand> strand, std::function<T()> work)
+        : strand(std::move(strand)), work(std::move(work)) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        strand->post([this, handle]() {
+            try {
+                result.emplace(work());
+            } catch (...) {
+                error = std::current_exception();
+            }
+            AsyncExecutor::getInstance().post([handle]() { handle.resume(); });
+        });
+    }
+
+    T await_resume() {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return std::move(*result);
+    }
+
+private:
+    std::shared_ptr<AsyncStrand> strand;
+    std::function<T()> work;
+    std::optional<T> result;
+    std::exception_ptr error;
+};
+
+template <>
+class AsyncAwaitable<void> {
+public:
+    AsyncAwaitable(std::shared_ptr<AsyncStrand> strand, std::function<void()> work)
+        : strand(std::move(strand)), work(std::move(work)) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        strand->post([this, handle]() {
+            try {
+                work();
+            } catch (...) {
+                error = std::current_exception();
+            }
+            AsyncExecutor::getInstance().post([handle]() { handle.resume(); });
+        });
+    }
+
+    void await_resume() {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    std::shared_ptr<AsyncStrand> strand;
+    std::function<void()> work;
+    std::exception_ptr error;
+};
+#endif // __cpp_impl_coroutine
+
+#endif // ASYNC_EXECUTOR_H
@@ -0,0 +1,55 @@
+#ifndef GROUP_COMMIT_WRITER_H
+#define GROUP_COMMIT_WRITER_H
+
+#include <memory>
+#include <functional>
+#include <future>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include "database/DatabaseConfig.h"
+#include "database/IDatabaseConnection.h"
+#include "utils/logger/Logger.h"
+
+// 여러 스레드의 쓰기 작업을 하나의 쓰기 스레드가 모아 한 트랜잭션으로 커밋합니다.
+// 작업마다 SAVEPOINT를 두어 한 작업이 실패해도 같은 배치의 다른 작업은 커밋됩니다.
+// 각 작업의 future는 배치가 커밋된 뒤에 완료됩니다.
+class GroupCommitWriter {
+public:
+    // 작업은 쓰기 스레드에서 실행되며 영향받은 행 수를 반환합니다.
+    using Operation = std::function<int(IDatabaseConnection&)>;
+
+    // 쓰기 스레드 전용 연결을 엽니다. 풀의 연결을 쓰지 않으므로 쓰기 연결을 쥔 세션이 있어도 멈추지 않습니다.
+    // 배치는 maxBatchSize개의 작업이 모이거나 첫 작업 이후 maxDelay가 지나면 커밋됩니다.
+    GroupCommitWriter(const DatabaseConfig& config, size_t maxBatchSize, std::chrono::milliseconds maxDelay);
+    ~GroupCommitWriter();
+
+    GroupCommitWriter(const GroupCommitWriter&) = delete;
+    GroupCommitWriter& operator=(const GroupCommitWriter&) = delete;
+
+    std::future<int> submit(Operation operation);
+
+private:
+    struct PendingOperation {
+        Operation operation;
+        std::promise<int> promise;
+    };
+
+    void run();
+    void commitBatch(std::vector<PendingOperation>& batch);
+
+    std::shared_ptr<IDatabaseConnection> connection;
+    size_t maxBatchSize;
+    std::chrono::milliseconds maxDelay;
+    Logger& logger;
+
+    std::mutex queueMutex;
+    std::condition_variable queueCondition;
+    std::vector<PendingOperation> queue;
+    bool stopping;
+    std::thread writerThread;
+};
+
+#endif // GROUP_COMMIT_WRITER_H
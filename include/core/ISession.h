@@ -10,6 +10,15 @@
 #include "ITransaction.h"
 #include "query/IQuery.h"
 #include "TransactionDefinition.h"
+#include "database/RetryPolicy.h"
+#include <functional>
+#include <future>
+
+// 쓰기 실행 시점
+enum class FlushMode {
+    Immediate, // save/update/remove가 즉시 SQL을 실행 (기본값)
+    Commit,    // 작업을 모아 두었다가 flush() 또는 커밋 시 한꺼번에 실행 (Unit of Work)
+};
 
 class ISession {
 public:
@@ -21,12 +30,33 @@ public:
     virtual void update(std::shared_ptr<IEntity> entity) = 0;
     // 엔티티 삭제
     virtual void remove(std::shared_ptr<IEntity> entity) = 0;
+    // 엔티티 일괄 저장/업데이트/삭제 (활성 트랜잭션이 없으면 하나의 트랜잭션으로 실행)
+    virtual void saveAll(const std::vector<std::shared_ptr<IEntity>>& entities) = 0;
+    virtual void updateAll(const std::vector<std::shared_ptr<IEntity>>& entities) = 0;
+    virtual void removeAll(const std::vector<std::shared_ptr<IEntity>>& entities) = 0;
+    // FlushMode::Commit에서 모아 둔 쓰기를 실행합니다. 같은 엔티티에 대한 작업은 하나로 합쳐지고,
+    // 엔티티 종류와 작업별로 묶어 관계(외래 키) 순서대로 실행됩니다.
+    virtual void flush() = 0;
+    virtual void setFlushMode(FlushMode mode) = 0;
+    virtual FlushMode getFlushMode() const = 0;
     // 엔티티 조회
     virtual std::shared_ptr<IEntity> find(const std::string& entityName, int id) = 0;
+    // 비동기 실행 (AsyncExecutor 작업자에서 세션의 작업을 제출 순서대로 하나씩 실행)
+    // 대기 중인 비동기 작업이 있는 동안에는 같은 세션의 동기 메서드를 호출하면 안 됩니다.
+    virtual std::future<void> saveAsync(std::shared_ptr<IEntity> entity) = 0;
+    virtual std::future<void> updateAsync(std::shared_ptr<IEntity> entity) = 0;
+    virtual std::future<void> removeAsync(std::shared_ptr<IEntity> entity) = 0;
+    virtual std::future<std::shared_ptr<IEntity>> findAsync(const std::string& entityName, int id) = 0;
     // 쿼리 생성
     virtual std::shared_ptr<IQuery> createQuery(const std::string& queryString) = 0;
     // 트랜잭션 관리
+    // 이미 트랜잭션이 진행 중이면 세이브포인트 기반의 중첩 트랜잭션을 반환합니다.
     virtual std::shared_ptr<ITransaction> beginTransaction(const TransactionDefinition& definition = TransactionDefinition()) = 0;
+    // 작업을 하나의 트랜잭션으로 실행하고 커밋합니다. 잠금 경합(LockAcquisitionException)으로 실패하면
+    // 롤백 후 정책에 따라 작업 전체를 다시 실행하므로, 작업은 여러 번 실행되어도 안전해야 합니다.
+    virtual void inTransaction(const std::function<void(ISession&)>& work,
+                               const RetryPolicy& retryPolicy = RetryPolicy(),
+                               const TransactionDefinition& definition = TransactionDefinition()) = 0;
     // 세션 닫기
     virtual void close() = 0;
 };
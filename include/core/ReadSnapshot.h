@@ -0,0 +1,34 @@
+#ifndef READ_SNAPSHOT_H
+#define READ_SNAPSHOT_H
+
+#include "database/IDatabaseConnection.h"
+#include "utils/logger/Logger.h"
+#include <functional>
+#include <memory>
+
+// 여러 읽기 트랜잭션이 공유하는 데이터베이스의 한 시점 (WAL 모드, SQLITE_ENABLE_SNAPSHOT 필요).
+// 시점을 잡은 읽기 트랜잭션을 소유 연결에서 열어두어, 체크포인트가 그 시점의 WAL 프레임을
+// 덮어쓰지 못하게 합니다. 마지막 참조가 사라지면 트랜잭션을 닫고 연결을 반납합니다.
+class ReadSnapshot {
+public:
+    using ConnectionReleaser = std::function<void(std::shared_ptr<IDatabaseConnection>)>;
+
+    ReadSnapshot(std::shared_ptr<IDatabaseConnection> connection, ConnectionReleaser releaser = nullptr);
+    ~ReadSnapshot();
+
+    ReadSnapshot(const ReadSnapshot&) = delete;
+    ReadSnapshot& operator=(const ReadSnapshot&) = delete;
+
+    // IDatabaseConnection::beginReadTransaction에 전달할 드라이버 스냅샷 핸들
+    const std::shared_ptr<void>& getHandle() const;
+
+private:
+    std::shared_ptr<IDatabaseConnection> connection;
+    ConnectionReleaser releaser;
+    std::shared_ptr<void> handle;
+    Logger& logger;
+
+    void close();
+};
+
+#endif // READ_SNAPSHOT_H
@@ -9,26 +9,169 @@
 #include "query/Query.h"
 #include "query/QueryBuilder.h"
 #include "TransactionDefinition.h"
+#include "ReadSnapshot.h"
+#include "GroupCommitWriter.h"
+#include "AsyncExecutor.h"
+#include <unordered_set>
+#include <functional>
+#include <mutex>
 
 class Session : public ISession {
 public:
-    explicit Session(std::shared_ptr<IDatabaseConnection> connection);
+    // 세션이 닫힐 때 연결을 돌려받는 함수 (예: 연결 풀 반납)
+    using ConnectionReleaser = std::function<void(std::shared_ptr<IDatabaseConnection>)>;
+    // 연결을 하나 빌려주고, 그 연결을 돌려받을 함수를 releaser에 채웁니다.
+    using ConnectionProvider = std::function<std::shared_ptr<IDatabaseConnection>(ConnectionReleaser& releaser)>;
+
+    explicit Session(std::shared_ptr<IDatabaseConnection> connection, ConnectionReleaser releaser = nullptr);
     virtual ~Session();
 
     void save(std::shared_ptr<IEntity> entity) override;
     void update(std::shared_ptr<IEntity> entity) override;
     void remove(std::shared_ptr<IEntity> entity) override;
+    void saveAll(const std::vector<std::shared_ptr<IEntity>>& entities) override;
+    void updateAll(const std::vector<std::shared_ptr<IEntity>>& entities) override;
+    void removeAll(const std::vector<std::shared_ptr<IEntity>>& entities) override;
+    void flush() override;
+    // Immediate로 바꾸면 대기 중인 작업을 먼저 실행합니다.
+    void setFlushMode(FlushMode mode) override;
+    FlushMode getFlushMode() const override;
     std::shared_ptr<IEntity> find(const std::string& entityName, int id) override;
+    std::future<void> saveAsync(std::shared_ptr<IEntity> entity) override;
+    std::future<void> updateAsync(std::shared_ptr<IEntity> entity) override;
+    std::future<void> removeAsync(std::shared_ptr<IEntity> entity) override;
+    std::future<std::shared_ptr<IEntity>> findAsync(const std::string& entityName, int id) override;
     std::shared_ptr<IQuery> createQuery(const std::string& queryString) override;
     std::shared_ptr<ITransaction> beginTransaction(const TransactionDefinition& definition = TransactionDefinition()) override;
+    void inTransaction(const std::function<void(ISession&)>& work,
+                       const RetryPolicy& retryPolicy = RetryPolicy(),
+                       const TransactionDefinition& definition = TransactionDefinition()) override;
     std::shared_ptr<IQueryBuilder> createQueryBuilder();
+    // 트랜잭션 밖의 단건 save/update/remove를 그룹 커밋 쓰기 스레드로 보냅니다.
+    void setGroupCommitWriter(std::shared_ptr<GroupCommitWriter> writer);
+    // 읽기 전용 트랜잭션을 세션 연결 대신 이 함수가 빌려준 연결에서 실행하고, 트랜잭션이 끝나면 반납합니다.
+    // (읽기/쓰기 분리 모드에서 하나뿐인 쓰기 연결을 읽기 트랜잭션이 붙잡지 않도록 함)
+    void setReadConnectionProvider(ConnectionProvider provider);
+    // 쿼리 결과 엔티티의 지연 로딩 관계를 일괄 조회할 때 IN 목록 하나에 넣을 최대 키 수
+    void setBatchFetchSize(size_t size);
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+    // co_await session.awaitable([&](Session& s) { return s.find("User", 1); });
+    template <typename F>
+    auto awaitable(F work) -> AsyncAwaitable<std::invoke_result_t<F&, Session&>> {
+        return AsyncAwaitable<std::invoke_result_t<F&, Session&>>(asyncStrand, [this, work]() mutable {
+            return work(*this);
+        });
+    }
+#endif
     void close() override;
 
 private:
+    using EntityGroup = std::pair<std::shared_ptr<const EntityMapping>, std::vector<std::shared_ptr<IEntity>>>;
+
+    // 엔티티를 매핑별로 묶습니다. (처음 등장한 순서 유지)
+    std::vector<EntityGroup> groupByMapping(const std::vector<std::shared_ptr<IEntity>>& entities);
+    // 매핑 하나의 엔티티들을 묶어 실행합니다. (runInBatch 안에서 호출)
+    void insertGroup(const EntityGroup& group);
+    void updateGroup(const EntityGroup& group);
+    void removeGroup(const EntityGroup& group);
+
+    // Unit of Work: flush 전까지 대기 중인 쓰기 (엔티티당 하나)
+    struct PendingWrite {
+        enum class Kind {
+            Insert,
+            Update,
+            Delete,
+        };
+        Kind kind;
+        std::shared_ptr<const EntityMapping> mapping;
+        std::shared_ptr<IEntity> entity;
+        bool cancelled; // INSERT 후 DELETE로 상쇄됨
+    };
+
+    bool deferWrites() const;
+    void enqueueWrite(PendingWrite::Kind kind, const std::shared_ptr<const EntityMapping>& mapping,
+                      const std::shared_ptr<IEntity>& entity);
+    // 외래 키를 가진 매핑이 참조하는 매핑 뒤에 오도록 정렬합니다.
+    std::vector<std::shared_ptr<const EntityMapping>> orderByDependencies(
+        const std::vector<std::shared_ptr<const EntityMapping>>& mappings);
+
+    // 활성 트랜잭션이 없으면 작업을 하나의 트랜잭션으로 감싸 실행합니다.
+    void runInBatch(const std::function<void()>& work);
+
+    FetchContext fetchContext();
+    // 쿼리가 함께 읽은 엔티티를 1차 캐시에 등록합니다. 같은 키의 엔티티가 이미 있으면 그것을 반환합니다.
+    std::shared_ptr<IEntity> registerLoaded(const EntityMapping& mapping, const std::shared_ptr<IEntity>& entity);
+    // stream()으로 연 커서를 등록합니다. 세션이 이미 닫혔으면 바로 무효화합니다.
+    void trackCursor(const std::shared_ptr<QueryCursor>& cursor);
+    // 아직 열린 커서를 모두 닫고 이후 사용을 막습니다. (close에서 연결을 반납하기 전에 호출)
+    void invalidateCursors();
+
+    // 단건 쓰기를 실행합니다. 그룹 커밋 모드이고 활성 트랜잭션이 없으면 배치가 커밋될 때까지 기다립니다.
+    int executeWrite(const std::string& query, const std::vector<SQLParameter>& params);
+
+    static std::string cacheKey(const std::string& entityName, const std::string& id);
+    // 쓰기 결과를 1차 캐시에 반영하고 2차 캐시 엔트리를 무효화합니다.
+    // 트랜잭션 중에는 2차 캐시 무효화를 커밋 시점까지 미룹니다.
+    // 쓴 엔티티의 값은 dirty checking 스냅샷으로 보관합니다.
+    void recordWrite(const EntityMapping& mapping, const std::shared_ptr<IEntity>& entity, bool removed);
+    // dirty checking 기준값. 스냅샷을 만든 인스턴스에만 적용합니다.
+    struct EntitySnapshot {
+        std::weak_ptr<const IEntity> owner;
+        std::vector<SQLParameter> values;
+    };
+    // dirty checking: 엔티티 필드 값을 소유한 복사본으로 읽습니다.
+    static EntitySnapshot captureFieldValues(const EntityMapping& mapping, const std::shared_ptr<IEntity>& entity);
+    // 스냅샷과 비교해 바뀐 컬럼만 쓰는 UPDATE 문과 파라미터를 만듭니다. 바뀐 컬럼이 없으면 false를 반환합니다.
+    // 이 인스턴스의 스냅샷이 없으면(쿼리나 2차 캐시에서 얻었거나 같은 ID로 새로 만든 엔티티 등) 모든 컬럼을 씁니다.
+    bool prepareUpdate(const EntityMapping& mapping, const IEntity& entity, std::string& query,
+                       std::vector<SQLParameter>& params);
+    // 트랜잭션 종료 시 미뤄둔 무효화를 적용(커밋)하거나 폐기(롤백)합니다.
+    void completeTransaction(bool committed);
+    // 읽기 연결에서 DEFERRED 읽기 트랜잭션을 엽니다. 쓰기가 없으므로 캐시 무효화 처리를 하지 않습니다.
+    std::shared_ptr<ITransaction> beginReadOnlyTransaction(const TransactionDefinition& definition);
+    // 읽기 전용 트랜잭션이 빌린 연결을 반납하고 세션 연결로 되돌립니다.
+    void restoreSessionConnection();
+    // 격리 수준에 필요한 연결 설정을 적용하고, 트랜잭션이 끝나면 되돌립니다.
+    void applyIsolationLevel(IsolationLevel isolationLevel);
+    void resetIsolationLevel();
+    // 중첩 트랜잭션(depth번째 세이브포인트)이 끝나면 그 안에서 쓴 키를 바깥 단계로 합치거나(커밋) 1차 캐시에서 폐기(롤백)합니다.
+    // 롤백하면 세이브포인트 안에서 대기열에 넣은 작업도 버립니다.
+    void completeSavepoint(size_t depth, bool committed);
+    // 대기열을 pendingWrites[0, size)로 줄이고 pendingIndex를 다시 만듭니다.
+    void truncatePendingWrites(size_t size);
+
     std::shared_ptr<IDatabaseConnection> connection;
+    ConnectionReleaser releaser;
+    ConnectionProvider readConnectionProvider;
+    std::shared_ptr<IDatabaseConnection> sessionConnection; // 읽기 전용 트랜잭션이 다른 연결을 쓰는 동안 보관한 세션 연결
+    ConnectionReleaser readConnectionReleaser;              // 읽기 전용 트랜잭션이 빌린 연결의 반납 함수
+    std::shared_ptr<GroupCommitWriter> groupCommitWriter;
+    std::shared_ptr<AsyncStrand> asyncStrand; // 비동기 작업을 순서대로 실행
+    std::shared_ptr<const void> lifetime;     // close 시 해제. 지연 로딩이 닫힌 세션의 연결을 쓰지 않도록 확인
+    size_t batchFetchSize;
     Logger& logger;
     bool isTransactionActive;
+    bool readOnlyTransaction;  // 현재 트랜잭션이 읽기 전용인지
+    bool readUncommitted;      // PRAGMA read_uncommitted를 켠 상태인지
+    FlushMode flushMode;
+    bool flushing;             // flush가 대기 중인 작업을 실행하는 중인지
+    std::vector<PendingWrite> pendingWrites;
+    std::unordered_map<const IEntity*, size_t> pendingIndex; // 엔티티 -> pendingWrites 인덱스
     std::unordered_map<std::string, std::shared_ptr<IEntity>> entityCache; // 1차 캐시
+    std::unordered_set<std::string> pendingInvalidations; // 커밋 시 2차 캐시에서 제거할 키
+    std::unordered_map<std::string, EntitySnapshot> entitySnapshots; // 마지막으로 알려진 DB 상태 (dirty checking)
+    // 열린 세이브포인트 (안쪽이 뒤)
+    struct SavepointState {
+        std::unordered_set<std::string> writtenKeys; // 세이브포인트 안에서 쓴 키
+        size_t pendingWatermark;                     // 세이브포인트를 열 때의 pendingWrites 크기
+    };
+    std::vector<SavepointState> savepoints;
+    uint64_t savepointSequence; // 세이브포인트 이름의 세션별 증가 번호
+    // stream()으로 연 커서 (다른 스레드에서 열 수 있으므로 cursorMutex로 보호)
+    std::mutex cursorMutex;
+    std::vector<std::weak_ptr<QueryCursor>> openCursors;
+    bool cursorsClosed;
 };
 
 #endif // SESSION_H
\ No newline at end of file
@@ -3,15 +3,43 @@
 
 #include "ConnectionPool.h"
 #include "DatabaseConfig.h"
+#include "Session.h"
+#include "GroupCommitWriter.h"
+#include "ReadSnapshot.h"
 #include <memory>
+#include <atomic>
 
 class SessionFactory {
 public:
     static SessionFactory& getInstance();
 
+    // 동시 사용 전에 호출해야 합니다.
     void configure(const DatabaseConfig& config);
+
+    // 풀에서 연결을 빌린 세션을 엽니다. 세션을 닫으면 연결이 풀로 반납됩니다.
+    // ReadWriteSplit 모드에서 readOnly 세션은 읽기 연결을, 그 외 세션은 쓰기 연결을 사용합니다.
+    std::shared_ptr<Session> openSession(bool readOnly = false);
+
+    // 읽기 연결 하나에서 현재 시점을 잡아 공유 스냅샷을 만듭니다. (WAL 모드, SQLITE_ENABLE_SNAPSHOT 필요)
+    // TransactionDefinition::snapshot으로 넘기면 여러 읽기 세션이 같은 시점의 데이터를 병렬로 읽습니다.
+    // 스냅샷이 살아 있는 동안 연결 하나를 점유하고, 그 이후의 WAL 체크포인트가 지연됩니다.
+    std::shared_ptr<ReadSnapshot> captureSnapshot();
+
+    // 쓰기(또는 공유) 연결
     std::shared_ptr<IDatabaseConnection> getConnection();
     void releaseConnection(std::shared_ptr<IDatabaseConnection> connection);
+    // 읽기 연결 (ReadWriteSplit 모드가 아니면 getConnection()과 같은 풀을 사용)
+    std::shared_ptr<IDatabaseConnection> getReadConnection();
+    void releaseReadConnection(std::shared_ptr<IDatabaseConnection> connection);
+
+    // 스레드 고정 모드에서 한 스레드가 계속 빌려 쓰는 연결.
+    // 소유 스레드가 종료되면 풀로 반납됩니다. (사용 중이면 사용이 끝날 때 반납)
+    struct ConnectionLease {
+        std::shared_ptr<IDatabaseConnection> connection;
+        std::weak_ptr<ConnectionPool> pool;
+        std::atomic<bool> inUse{false};
+        std::atomic<bool> owned{true}; // 소유 스레드가 살아 있는지
+    };
 
 private:
     SessionFactory();
@@ -20,7 +48,23 @@ private:
     SessionFactory(const SessionFactory&) = delete;
     SessionFactory& operator=(const SessionFactory&) = delete;
 
-    std::unique_ptr<ConnectionPool> connectionPool;
+    void configureReadWriteSplit(const DatabaseConfig& config);
+    const std::shared_ptr<ConnectionPool>& readPool() const;
+    // 스레드의 임대 연결이 비어 있으면 잠금 없이 반환하고, 아니면 풀에서 빌립니다.
+    // granted에는 임대 연결을 사용한 경우 해당 임대가 설정됩니다.
+    std::shared_ptr<IDatabaseConnection> acquire(const std::shared_ptr<ConnectionPool>& pool, bool read,
+                                                 std::shared_ptr<ConnectionLease>& granted);
+    static void release(const std::shared_ptr<ConnectionPool>& pool, const std::shared_ptr<ConnectionLease>& granted,
+                        std::shared_ptr<IDatabaseConnection> connection);
+    // 현재 스레드의 임대 연결이면 임대를 반환합니다.
+    std::shared_ptr<ConnectionLease> findLease(const std::shared_ptr<IDatabaseConnection>& connection, bool read) const;
+    bool usesLease(bool read) const;
+
+    std::shared_ptr<ConnectionPool> connectionPool; // 쓰기 전용 또는 공유 풀
+    std::shared_ptr<ConnectionPool> readerPool;     // ReadWriteSplit 모드에서만 사용
+    std::shared_ptr<GroupCommitWriter> groupCommitWriter; // 그룹 커밋 모드에서만 사용
+    bool threadAffinity;
+    size_t batchFetchSize;
 };
 
 #endif // SESSION_FACTORY_H
@@ -2,22 +2,37 @@
 #define TRANSACTION_H
 
 #include "ITransaction.h"
+#include <functional>
+#include <string>
 #include "database/DatabaseConnectionFactory.h"
 #include "utils/logger/Logger.h"
 
 class Transaction : public ITransaction {
 public:
-    Transaction(std::shared_ptr<IDatabaseConnection> connection, bool& transactionFlag);
+    // completionCallback은 커밋(true) 또는 롤백(false) 직후 호출됩니다.
+    // savepointName이 있으면 바깥 트랜잭션 안의 중첩 트랜잭션으로, commit은 RELEASE,
+    // rollback은 ROLLBACK TO 로 처리되며 실제 커밋은 바깥 트랜잭션이 담당합니다.
+    Transaction(std::shared_ptr<IDatabaseConnection> connection, bool& transactionFlag,
+                std::function<void(bool)> completionCallback = nullptr,
+                const std::string& savepointName = "");
     virtual ~Transaction();
 
     void commit() override;
     void rollback() override;
 
+    // COMMIT(중첩 트랜잭션은 RELEASE) 직전에 호출됩니다. 예외가 나면 커밋하지 않고 트랜잭션을 유지합니다.
+    void setBeforeCommit(std::function<void()> callback);
+
 private:
     std::shared_ptr<IDatabaseConnection> connection;
     Logger& logger;
     bool& isTransactionActive;
     bool isCommittedOrRolledBack;
+    std::function<void(bool)> completionCallback;
+    std::function<void()> beforeCommit;
+    std::string savepointName;
+
+    void completeSavepoint(bool commit);
 };
 
 #endif // TRANSACTION_H
\ No newline at end of file
@@ -1,12 +1,17 @@
 #ifndef TRANSACTION_DEFINITION_H
 #define TRANSACTION_DEFINITION_H
 
+#include <memory>
+
+class ReadSnapshot;
+
+// SQLite 트랜잭션은 기본적으로 직렬화 가능하므로 아래 두 수준만 동작을 바꿉니다.
 enum class IsolationLevel {
     DEFAULT, // SQLite에서는 DEFERRED와 동일
-    READ_UNCOMMITTED,
+    READ_UNCOMMITTED, // 트랜잭션 동안 PRAGMA read_uncommitted (공유 캐시 연결에서만 효과)
     READ_COMMITTED,
     REPEATABLE_READ,
-    SERIALIZABLE,
+    SERIALIZABLE, // 쓰기 트랜잭션의 DEFERRED를 IMMEDIATE로 올려 잠금 승격 실패를 피함
 };
 
 enum class TransactionMode {
@@ -19,6 +24,9 @@ struct TransactionDefinition
 {
     IsolationLevel isolationLevel = IsolationLevel::DEFAULT;
     TransactionMode transactionMode = TransactionMode::DEFERRED;
+    bool readOnly = false; // 읽기 전용 세션(읽기 연결)에서 실행할 트랜잭션
+    // readOnly 트랜잭션이 읽을 공유 시점 (SessionFactory::captureSnapshot). 없으면 시작 시점의 데이터를 읽음
+    std::shared_ptr<const ReadSnapshot> snapshot;
 };
 
 
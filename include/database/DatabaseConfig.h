@@ -2,12 +2,21 @@
 #define DATABASE_CONFIG_H
 
 #include <string>
+#include <cstddef>
+#include <chrono>
+#include "TuningProfile.h"
+#include "RetryPolicy.h"
 
 enum class DatabaseType {
     SQLite,
     // 향후 다른 데이터베이스 타입 추가 가능
 };
 
+enum class PoolMode {
+    Shared,         // 모든 세션이 같은 연결 풀을 공유
+    ReadWriteSplit, // 쓰기 전용 연결 1개 + 읽기 전용(WAL) 연결 N개
+};
+
 class DatabaseConfig {
 public:
     DatabaseConfig();
@@ -15,14 +24,70 @@ public:
     // 설정 메서드
     void setDatabaseType(DatabaseType type);
     void setDatabaseName(const std::string& name);
+    void setPoolMode(PoolMode mode);
+    // ReadWriteSplit 모드의 읽기 연결 수 (0이면 하드웨어 스레드 수)
+    void setReaderCount(size_t count);
+    // 연결을 읽기 전용(SQLITE_OPEN_READONLY)으로 엽니다.
+    void setReadOnly(bool readOnly);
+    // 연결 시 WAL 저널 모드로 전환합니다. (튜닝 설정의 journalMode를 변경, false는 WAL일 때만 기본값으로 되돌림)
+    void setWalMode(bool walMode);
+    // 새 연결마다 적용할 PRAGMA/열기 옵션
+    void setTuningProfile(const TuningProfile& profile);
+    // 잠금 경합 시 재시도 정책. 자동 커밋 상태의 단일 문과 BEGIN/COMMIT에 적용되며,
+    // 바쁜 대기(busy handler)의 대기 간격에도 사용됩니다.
+    void setRetryPolicy(const RetryPolicy& policy);
+    // 연결 풀 크기 (최소 연결은 미리 열어두고, 최대까지 필요에 따라 늘립니다)
+    void setMinPoolSize(size_t size);
+    void setMaxPoolSize(size_t size);
+    // 연결 획득 대기 시간 (초과하면 DatabaseConnectionException)
+    void setConnectionTimeout(std::chrono::milliseconds timeout);
+    // 최소 크기를 넘는 연결이 이 시간 동안 사용되지 않으면 닫습니다. (0이면 닫지 않음)
+    void setIdleTimeout(std::chrono::milliseconds timeout);
+    // 스레드마다 연결 하나를 계속 빌려 쓰는 모드. 같은 스레드의 세션은 풀 잠금 없이 임대 연결을 받습니다.
+    // 연결 잠금과 SQLite의 직렬화 모드는 그대로 유지합니다. (maxPoolSize는 작업 스레드 수 이상이어야 합니다)
+    void setThreadAffinity(bool enabled);
+    // 세션의 단건 쓰기를 하나의 쓰기 스레드로 모아 maxBatchSize개 또는 maxDelay마다 한 트랜잭션으로 커밋합니다.
+    void setGroupCommit(bool enabled, size_t maxBatchSize = 128,
+                        std::chrono::milliseconds maxDelay = std::chrono::milliseconds(2));
+    // 지연 로딩 관계를 일괄 조회할 때 IN 목록 하나에 넣을 최대 키 수
+    void setBatchFetchSize(size_t size);
 
     // Getter 메서드
     DatabaseType getDatabaseType() const;
     std::string getDatabaseName() const;
+    PoolMode getPoolMode() const;
+    size_t getReaderCount() const;
+    bool isReadOnly() const;
+    bool isWalMode() const;
+    const TuningProfile& getTuningProfile() const;
+    const RetryPolicy& getRetryPolicy() const;
+    size_t getMinPoolSize() const;
+    size_t getMaxPoolSize() const;
+    std::chrono::milliseconds getConnectionTimeout() const;
+    std::chrono::milliseconds getIdleTimeout() const;
+    bool isThreadAffinityEnabled() const;
+    bool isGroupCommitEnabled() const;
+    size_t getGroupCommitBatchSize() const;
+    std::chrono::milliseconds getGroupCommitDelay() const;
+    size_t getBatchFetchSize() const;
 
 private:
     DatabaseType dbType;
     std::string dbName;
+    PoolMode poolMode;
+    size_t readerCount;
+    bool readOnly;
+    TuningProfile tuning;
+    RetryPolicy retryPolicy;
+    size_t minPoolSize;
+    size_t maxPoolSize;
+    std::chrono::milliseconds connectionTimeout;
+    std::chrono::milliseconds idleTimeout;
+    bool threadAffinity;
+    bool groupCommit;
+    size_t groupCommitBatchSize;
+    std::chrono::milliseconds groupCommitDelay;
+    size_t batchFetchSize;
 };
 
 #endif // DATABASE_CONFIG_H
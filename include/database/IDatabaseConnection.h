@@ -4,7 +4,9 @@
 #include <string>
 #include <vector>
 #include <map>
-#include <any>
+#include <memory>
+#include "ResultSet.h"
+#include "SQLParameter.h"
 
 class IDatabaseConnection {
 public:
@@ -13,25 +15,42 @@ public:
     // Database connection and disconnection
     virtual void connect() = 0;
     virtual void disconnect() = 0;
+    // 연결이 열려 있고 트랜잭션 밖에 있어 재사용 가능한지 확인
+    virtual bool isValid() = 0;
 
     // Execute query with parameters
-    virtual std::vector<std::map<std::string, std::string>> executeQuery(
+    virtual ResultSet executeQuery(
         const std::string& query,
-        const std::vector<std::any>& params = {}) = 0;
+        const std::vector<SQLParameter>& params = {}) = 0;
 
     // Execute update with parameters
     virtual int executeUpdate(
         const std::string& query,
-        const std::vector<std::any>& params = {}) = 0;
+        const std::vector<SQLParameter>& params = {}) = 0;
 
     // Transaction management
     virtual void beginTransaction() = 0;
     virtual void commit() = 0;
     virtual void rollback() = 0;
+    // Read-only transaction, optionally pinned to a snapshot returned by captureSnapshot()
+    virtual void beginReadTransaction(const std::shared_ptr<void>& snapshot = nullptr) = 0;
+    // Snapshot of the open read transaction (nullptr if the driver does not support snapshots)
+    virtual std::shared_ptr<void> captureSnapshot() = 0;
+
+    // Maximum number of bound parameters in one statement
+    virtual int getMaxParameterCount() = 0;
 
     // Get native handle
     virtual void* getNativeHandle() = 0;
 
+    // Prepared statement cache owned by this connection
+    virtual void* acquireStatement(const std::string& query) = 0;
+    virtual void releaseStatement(void* statement) = 0;
+    // Step a statement from acquireStatement under the connection lock (true while rows remain)
+    virtual bool fetchRow(void* statement) = 0;
+    virtual std::shared_ptr<void> getStatementAttachment(void* statement, const std::string& key) = 0;
+    virtual void setStatementAttachment(void* statement, const std::string& key, std::shared_ptr<void> value) = 0;
+
     virtual std::string extractTableName(const std::string& query) = 0;
 };
 
@@ -0,0 +1,94 @@
+#ifndef RESULT_SET_H
+#define RESULT_SET_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <cstdint>
+
+enum class ColumnType {
+    Null,
+    Integer,
+    Real,
+    Text,
+    Blob,
+};
+
+// 한 셀의 값을 복사 없이 가리키는 뷰. text는 결과 집합(또는 커서의 현재 행)이 유지되는 동안만 유효합니다.
+struct ColumnValue {
+    ColumnType type = ColumnType::Null;
+    int64_t integer = 0;
+    double real = 0.0;
+    std::string_view text; // TEXT/BLOB 바이트
+
+    // ResultSet::getString과 같은 규칙으로 문자열로 변환합니다. NULL은 빈 문자열입니다.
+    std::string toString() const;
+};
+
+// 쿼리 결과를 행/열 인덱스로 접근하는 타입 기반 결과 집합.
+// 컬럼 이름 헤더는 복사본 간에 공유되고, 셀은 하나의 연속 배열에,
+// 텍스트/BLOB 데이터는 하나의 바이트 버퍼에 저장되어 셀 단위 할당이 없습니다.
+class ResultSet {
+public:
+    ResultSet();
+    explicit ResultSet(std::vector<std::string> columnNames);
+
+    // 크기 정보
+    size_t rowCount() const;
+    size_t columnCount() const;
+    bool empty() const;
+
+    // 컬럼 헤더
+    const std::vector<std::string>& getColumnNames() const;
+    const std::string& getColumnName(size_t column) const;
+    // 컬럼 이름을 인덱스로 변환합니다. 없으면 -1을 반환합니다.
+    int findColumn(const std::string& name) const;
+
+    // 셀 접근 (행, 열 인덱스)
+    ColumnType getType(size_t row, size_t column) const;
+    bool isNull(size_t row, size_t column) const;
+    int64_t getInt64(size_t row, size_t column) const;
+    double getDouble(size_t row, size_t column) const;
+    // TEXT/BLOB 셀의 원본 바이트를 복사 없이 반환합니다. 그 외 타입은 빈 값을 반환합니다.
+    std::string_view getText(size_t row, size_t column) const;
+    // 셀 값을 문자열로 변환합니다. NULL은 빈 문자열입니다.
+    std::string getString(size_t row, size_t column) const;
+    std::string getString(size_t row, const std::string& columnName) const;
+    // 셀 값을 변환 없이 반환합니다.
+    ColumnValue getValue(size_t row, size_t column) const;
+
+    // 결과 작성 (행 단위로 columnCount()개의 셀을 순서대로 추가)
+    void reserve(size_t rows, size_t dataBytes = 0);
+    void appendNull();
+    void appendInt64(int64_t value);
+    void appendDouble(double value);
+    void appendText(const char* text, size_t length);
+    void appendBlob(const void* data, size_t length);
+
+private:
+    struct Header {
+        std::vector<std::string> names;
+        std::unordered_map<std::string, size_t> index;
+    };
+
+    struct Cell {
+        ColumnType type;
+        uint32_t length;
+        union {
+            int64_t integer;
+            double real;
+            uint64_t offset;
+        };
+    };
+
+    const Cell& cellAt(size_t row, size_t column) const;
+    void appendBytes(ColumnType type, const void* data, size_t length);
+
+    std::shared_ptr<const Header> header;
+    std::vector<Cell> cells;
+    std::vector<char> data;
+};
+
+#endif // RESULT_SET_H
@@ -0,0 +1,23 @@
+#ifndef RETRY_POLICY_H
+#define RETRY_POLICY_H
+
+#include <chrono>
+#include <cstddef>
+
+// 잠금 경합(SQLITE_BUSY/SQLITE_LOCKED) 시 재시도 정책.
+// n번째 재시도 전 대기 시간은 min(maxBackoff, initialBackoff * multiplier^(n-1))에
+// [1 - jitter, 1] 범위의 임의 비율을 곱한 값입니다. (동시에 실패한 작업들이 같은 시점에 다시 충돌하지 않도록)
+struct RetryPolicy {
+    size_t maxAttempts = 5; // 첫 시도 포함. 1이면 재시도하지 않음
+    std::chrono::milliseconds initialBackoff{2};
+    std::chrono::milliseconds maxBackoff{200};
+    double multiplier = 2.0;
+    double jitter = 0.5;
+
+    // retry번째(1부터) 재시도 전에 기다릴 시간
+    std::chrono::microseconds backoff(size_t retry) const;
+
+    static RetryPolicy none();
+};
+
+#endif // RETRY_POLICY_H
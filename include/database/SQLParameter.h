@@ -0,0 +1,36 @@
+#ifndef SQL_PARAMETER_H
+#define SQL_PARAMETER_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <variant>
+#include <any>
+#include <cstdint>
+#include <cstddef>
+
+// 소유권을 가진 BLOB 값
+using Blob = std::vector<uint8_t>;
+
+// 호출자가 수명을 보장하는 BLOB 참조 (복사 없이 바인딩)
+struct BlobView {
+    const void* data;
+    size_t size;
+};
+
+// 바인딩 가능한 파라미터 값.
+// std::string_view / BlobView는 실행이 끝날 때까지 참조 대상이 유지되어야 합니다.
+using SQLParameter = std::variant<
+    std::nullptr_t,
+    int64_t,
+    double,
+    std::string,
+    std::string_view,
+    Blob,
+    BlobView>;
+
+// IEntity::getFieldValue 등에서 얻은 std::any 값을 파라미터로 변환합니다.
+// 지원하지 않는 타입이면 InvalidParameterException을 던집니다.
+SQLParameter toSQLParameter(const std::any& value);
+
+#endif // SQL_PARAMETER_H
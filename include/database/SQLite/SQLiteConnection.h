@@ -4,9 +4,11 @@
 #include "IDatabaseConnection.h"
 #include "DatabaseConfig.h"
 #include "../utils/logger/Logger.h"
+#include "StatementCache.h"
 #include <sqlite3.h>
-#include <any>
 #include <mutex>
+#include <unordered_set>
+#include <chrono>
 
 class SQLiteConnection : public IDatabaseConnection {
 public:
@@ -16,37 +18,95 @@ public:
     // Database connection and disconnection
     void connect() override;
     void disconnect() override;
+    bool isValid() override;
 
     // Execute query with parameters
-    std::vector<std::map<std::string, std::string>> executeQuery(
+    ResultSet executeQuery(
         const std::string& query,
-        const std::vector<std::any>& params = {}) override;
+        const std::vector<SQLParameter>& params = {}) override;
 
     // Execute update with parameters
     int executeUpdate(
         const std::string& query,
-        const std::vector<std::any>& params = {}) override;
+        const std::vector<SQLParameter>& params = {}) override;
 
     // Transaction management
     void beginTransaction() override;
     void commit() override;
     void rollback() override;
+    // SQLITE_ENABLE_SNAPSHOT 빌드에서는 snapshot(sqlite3_snapshot)이 가리키는 시점의 데이터를 읽습니다.
+    void beginReadTransaction(const std::shared_ptr<void>& snapshot = nullptr) override;
+    std::shared_ptr<void> captureSnapshot() override;
+
+    // Maximum number of bound parameters in one statement
+    int getMaxParameterCount() override;
 
     // Get native handle
     void* getNativeHandle() override;
 
+    // Prepared statement cache
+    void* acquireStatement(const std::string& query) override;
+    void releaseStatement(void* statement) override;
+    // 실패하면 잠금 경합은 LockAcquisitionException(재시도 횟수 포함), 그 외에는 QueryExecutionException을 던집니다.
+    bool fetchRow(void* statement) override;
+    std::shared_ptr<void> getStatementAttachment(void* statement, const std::string& key) override;
+    void setStatementAttachment(void* statement, const std::string& key, std::shared_ptr<void> value) override;
+
     std::string extractTableName(const std::string& query) override;
 
+    // 준비된 문의 결과를 ResultSet으로 변환하는 도우미
+    static ResultSet createResultSet(sqlite3_stmt* stmt);
+    static void appendRow(sqlite3_stmt* stmt, ResultSet& resultSet);
+    // 값을 복사하지 않고(SQLITE_STATIC) 바인딩합니다. 호출자는 문이 reset 될 때까지 값의 수명을 보장해야 합니다.
+    static int bindValue(sqlite3_stmt* stmt, int index, const SQLParameter& value);
+
+    // SQLITE_BUSY/SQLITE_LOCKED (확장 코드 포함) 여부
+    static bool isLockError(int rc);
+
+    // 캐시된 문이 읽는 테이블의 TableVersionRegistry 키 목록 (std::vector<std::string>)
+    static const std::string READ_TABLES_KEY;
+
 private:
     sqlite3* db;
     DatabaseConfig config;
     Logger& logger;
     bool isConnected;
-    bool isInTransaction;
     std::mutex connectionMutex;
+    StatementCache statementCache;
+
+    std::unique_lock<std::mutex> lockConnection();
+    void applyTuning(const TuningProfile& tuning);
+    // PRAGMA를 실행하고 첫 번째 결과 값을 반환합니다. 실패하면 경고만 남깁니다.
+    std::string runPragma(const std::string& pragma);
+    sqlite3_stmt* prepareCachedStatement(const std::string& query);
+    void executeTransactionStatement(const std::string& statement);
+    void bindParameters(sqlite3_stmt* stmt, const std::vector<SQLParameter>& params);
+    // 첫 step을 실행합니다. retryable이면 잠금 경합 시 재시도 정책에 따라 다시 실행합니다.
+    int stepStatement(sqlite3_stmt* stmt, bool retryable);
+    // 잠금 경합이면 LockAcquisitionException, 그 외에는 QueryExecutionException을 던집니다.
+    [[noreturn]] void throwStepError(int rc, const std::string& context);
+
+    // 잠금 경합 처리
+    size_t retries; // 마지막 문 실행 중 재시도/바쁜 대기 횟수
+    std::chrono::steady_clock::time_point busyStart;
+    static int onBusy(void* context, int count);
+
+    // 테이블 변경 추적 (쿼리 결과 캐시 무효화용)
+    std::string databaseKey;                     // 연결된 데이터베이스 파일 경로 (메모리 DB는 빈 문자열)
+    std::unordered_set<std::string> dirtyTables; // 현재 트랜잭션에서 변경된 테이블
+    std::vector<std::string> committedTables;    // 커밋되었지만 아직 게시되지 않은 테이블
+    std::vector<std::string>* readTableCollector; // 문 준비 중 읽는 테이블을 수집할 대상
+    std::vector<std::string>* writeTableCollector; // 문 준비 중 쓰는(또는 삭제하는) 테이블을 수집할 대상
+
+    // 캐시된 문이 쓰는 테이블 이름 목록 (std::vector<std::string>)
+    static const std::string WRITE_TABLES_KEY;
 
-    void finalizeStatement(sqlite3_stmt* stmt);
-    void bindParameters(sqlite3_stmt* stmt, const std::vector<std::any>& params);
+    void installHooks();
+    void publishCommittedTables();
+    static void onUpdate(void* context, int operation, const char* database, const char* table, sqlite3_int64 rowId);
+    static int onCommit(void* context);
+    static void onRollback(void* context);
+    static int onAuthorize(void* context, int action, const char* arg1, const char* arg2, const char* database, const char* trigger);
 };
 
 #endif // SQLITE_CONNECTION_H
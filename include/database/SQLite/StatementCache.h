@@ -0,0 +1,54 @@
+#ifndef STATEMENT_CACHE_H
+#define STATEMENT_CACHE_H
+
+#include <string>
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <sqlite3.h>
+
+// 연결(sqlite3*) 단위의 Prepared Statement LRU 캐시.
+// 같은 SQL 문자열은 한 번만 파싱하고, 사용이 끝난 문은 reset/clear_bindings 후 재사용합니다.
+// 동기화는 소유자(SQLiteConnection)가 담당합니다.
+class StatementCache {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 64;
+
+    explicit StatementCache(size_t capacity = DEFAULT_CAPACITY);
+    ~StatementCache();
+
+    StatementCache(const StatementCache&) = delete;
+    StatementCache& operator=(const StatementCache&) = delete;
+
+    // 준비된 문을 대여합니다. 같은 SQL의 문이 이미 사용 중이면 캐시되지 않는 문을 새로 준비합니다.
+    sqlite3_stmt* acquire(sqlite3* db, const std::string& sql);
+    // 대여한 문을 반납합니다. 캐시된 문은 reset 후 보관하고, 그렇지 않으면 finalize 합니다.
+    void release(sqlite3_stmt* stmt);
+    // 캐시를 비웁니다. 사용 중인 문은 반납 시 finalize 됩니다. (연결 종료 전 호출)
+    void clear();
+
+    // 캐시된 문에 부가 정보(예: 결과 매핑 계획)를 연결합니다. 문이 제거되면 함께 해제됩니다.
+    std::shared_ptr<void> getAttachment(sqlite3_stmt* stmt, const std::string& key) const;
+    void setAttachment(sqlite3_stmt* stmt, const std::string& key, std::shared_ptr<void> value);
+
+    size_t size() const;
+    size_t getCapacity() const;
+
+private:
+    struct Entry {
+        std::string sql;
+        sqlite3_stmt* stmt;
+        bool inUse;
+        std::vector<std::pair<std::string, std::shared_ptr<void>>> attachments;
+    };
+
+    void evictIfNeeded();
+
+    size_t capacity;
+    std::list<Entry> entries; // 앞쪽이 가장 최근에 사용된 문
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    std::unordered_map<sqlite3_stmt*, std::list<Entry>::iterator> byStatement;
+};
+
+#endif // STATEMENT_CACHE_H
@@ -0,0 +1,61 @@
+#ifndef TUNING_PROFILE_H
+#define TUNING_PROFILE_H
+
+#include <string>
+#include <chrono>
+#include <cstdint>
+
+enum class JournalMode {
+    Default, // 데이터베이스 파일의 현재 설정 유지
+    Delete,
+    Truncate,
+    Persist,
+    Memory,
+    WAL,
+    Off,
+};
+
+enum class SynchronousMode {
+    Default,
+    Off,
+    Normal,
+    Full,
+    Extra,
+};
+
+enum class TempStore {
+    Default,
+    File,
+    Memory,
+};
+
+// 새 연결마다 적용할 SQLite 설정. 0 또는 Default 값은 SQLite 기본값을 그대로 사용합니다.
+struct TuningProfile {
+    JournalMode journalMode = JournalMode::Default;
+    SynchronousMode synchronous = SynchronousMode::Default;
+    int64_t cacheSizeKiB = 0;                  // PRAGMA cache_size (KiB 단위)
+    int64_t mmapSize = 0;                      // PRAGMA mmap_size (바이트)
+    TempStore tempStore = TempStore::Default;
+    int pageSize = 0;                          // PRAGMA page_size (새 데이터베이스에만 적용)
+    // 잠금 경합 시 최대 대기 시간. 0보다 크면 RetryPolicy의 지터 백오프 간격으로 기다리는 busy handler를
+    // 설치하고(sqlite3_busy_timeout은 사용하지 않음), 0이면 기다리지 않고 바로 SQLITE_BUSY를 반환합니다.
+    std::chrono::milliseconds busyTimeout{0};
+    int64_t softHeapLimit = 0;                 // sqlite3_soft_heap_limit64 (프로세스 전역, 바이트)
+    // SQLITE_OPEN_NOMUTEX. 어떤 프리셋도 켜지 않으므로 직접 지정해야 합니다.
+    // 각 연결을 한 스레드에서만 쓰는 경우에만 안전합니다. (비동기 API·다른 스레드의 지연 로딩·커서 사용 금지)
+    bool noMutex = false;
+    bool sharedCache = false;                  // SQLITE_OPEN_SHAREDCACHE
+
+    // 이름으로 미리 정의된 설정을 찾습니다. ("default", "durable", "throughput", "read-replica")
+    // 알 수 없는 이름이면 ConfigurationException을 던집니다.
+    static TuningProfile preset(const std::string& name);
+
+    // 커밋마다 fsync 하여 전원 장애에도 커밋을 잃지 않는 설정 (WAL + FULL)
+    static TuningProfile durable();
+    // 쓰기 처리량 우선 설정 (WAL + NORMAL, 큰 캐시와 mmap). 전원 장애 시 마지막 커밋을 잃을 수 있습니다.
+    static TuningProfile throughput();
+    // 읽기 전용 연결용 설정. 저널 모드는 쓰기 연결이 정한 값을 따릅니다.
+    static TuningProfile readReplica();
+};
+
+#endif // TUNING_PROFILE_H
@@ -4,13 +4,39 @@
 #include <string>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 #include <functional>
+#include <mutex>
+#include <cstdint>
 #include "IEntity.h"
 #include "include/utils/logger/Logger.h"
+#include "include/database/SQLParameter.h"
+#include "include/database/ResultSet.h"
+
+// 컴파일 시 생성되는 필드 접근자 (EntityReflection.h의 ZENIX_ENTITY 참고).
+// 설정되지 않은 필드는 IEntity의 문자열 기반 getFieldValue/setFieldValue를 사용합니다.
+struct FieldAccessor {
+    ColumnType type = ColumnType::Null; // 멤버의 기본 컬럼 타입
+    // 멤버 값을 파라미터로 읽습니다. 문자열/BLOB은 복사 없이 참조하므로 엔티티가 실행 동안 유지되어야 합니다.
+    SQLParameter (*read)(const IEntity& entity) = nullptr;
+    void (*write)(IEntity& entity, const ColumnValue& value) = nullptr;
+};
 
 struct FieldMapping {
     std::string fieldName;
     std::string columnName;
+    FieldAccessor accessor;
+
+    SQLParameter readParameter(const IEntity& entity) const {
+        return accessor.read ? accessor.read(entity) : toSQLParameter(entity.getFieldValue(fieldName));
+    }
+    void assign(IEntity& entity, const ColumnValue& value) const {
+        if (accessor.write) {
+            accessor.write(entity, value);
+        } else {
+            entity.setFieldValue(fieldName, value.toString());
+        }
+    }
 };
 
 struct Relationship {
@@ -21,6 +47,16 @@ struct Relationship {
     std::string joinColumn; // 외래 키 컬럼.
 };
 
+// registerEntity에서 한 번 생성되는 CRUD SQL
+struct EntitySQL {
+    std::string insert;         // INSERT INTO t (c1, c2) VALUES (?, ?);
+    std::string update;         // UPDATE t SET c1 = ?, c2 = ? WHERE id = ?;
+    std::string remove;         // DELETE FROM t WHERE id = ?;
+    std::string selectById;     // SELECT * FROM t WHERE id = ?;
+    std::string columnList;     // c1, c2 (다중 행 INSERT용)
+    std::string rowPlaceholder; // (?, ?) (다중 행 INSERT용)
+};
+
 struct EntityMapping {
     std::string entityName;
     std::string tableName;
@@ -28,22 +64,48 @@ struct EntityMapping {
     std::vector<FieldMapping> fields;
     std::vector<Relationship> relationships;
     std::function<std::shared_ptr<IEntity>()> entityConstructor;
+    EntitySQL sql; // 등록 시 자동 생성
+    uint32_t typeId = 0; // 등록 시 부여되는 작은 정수 ID (1부터 시작)
+    FieldAccessor idAccessor; // ZENIX_ENTITY로 만든 매핑에서만 설정
+
+    void assignId(IEntity& entity, const ColumnValue& value) const {
+        if (idAccessor.write) {
+            idAccessor.write(entity, value);
+        } else {
+            entity.setId(value.toString());
+        }
+    }
 };
 
 class EntityMapper {
 public:
     static EntityMapper& getInstance();
 
+    // 등록된 매핑은 불변 객체로 공유되며, 조회 시 복사하지 않습니다.
+    // 조회는 잠금 없이 현재 스냅샷을 읽고, 등록은 새 스냅샷을 만들어 교체합니다.
     void registerEntity(const EntityMapping& mapping);
-    std::shared_ptr<EntityMapping> getMapping(const std::string& entityName);
-    std::shared_ptr<EntityMapping> getMappingByTableName(const std::string& tableName);
+    std::shared_ptr<const EntityMapping> getMapping(const std::string& entityName) const;
+    std::shared_ptr<const EntityMapping> getMappingByTableName(const std::string& tableName) const;
+    std::shared_ptr<const EntityMapping> getMappingByTypeId(uint32_t typeId) const;
 
 private:
     EntityMapper();
     EntityMapper(const EntityMapper&) = delete;
     EntityMapper& operator=(const EntityMapper&) = delete;
 
-    std::unordered_map<std::string, EntityMapping> mappings;
+    // 불변 레지스트리 스냅샷
+    struct Registry {
+        std::unordered_map<std::string, std::shared_ptr<const EntityMapping>> byEntityName;
+        std::unordered_map<std::string, std::shared_ptr<const EntityMapping>> byTableName;
+        std::vector<std::shared_ptr<const EntityMapping>> byTypeId; // 인덱스 0은 사용하지 않음
+    };
+
+    static EntitySQL buildSQL(const EntityMapping& mapping);
+
+    // 현재 스냅샷. std::atomic_load/atomic_store로만 접근하며, 읽는 쪽이 shared_ptr을 잡고 있는 동안
+    // 지난 스냅샷이 유지되고 마지막 참조가 사라지면 해제됩니다.
+    std::shared_ptr<const Registry> current;
+    std::mutex registerMutex;
     Logger& logger;
 };
 
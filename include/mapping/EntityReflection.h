@@ -0,0 +1,243 @@
+#ifndef ENTITY_REFLECTION_H
+#define ENTITY_REFLECTION_H
+
+#include <any>
+#include <cstdlib>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "IEntity.h"
+#include "EntityMapper.h"
+#include "include/utils/ORMException/MappingException/MappingException.h"
+
+// 컴파일 시 엔티티 필드 목록을 선언합니다. 첫 번째 멤버는 ID입니다.
+//
+//   class User : public IEntity {
+//   public:
+//       int64_t id = 0;
+//       std::string name;
+//       int age = 0;
+//       ZENIX_ENTITY(User, id, name, age)
+//   };
+//   EntityMapper::getInstance().registerEntity(EntityReflection::makeMapping<User>("users"));
+//
+// IEntity의 문자열 기반 메서드도 함께 생성되지만, Session/Query는 매핑의 FieldAccessor를 통해
+// 멤버를 직접 읽고 씁니다. (필드 이름 조회, std::any, 숫자의 문자열 변환 없음)
+#define ZENIX_ENTITY(Type, ...)                                                                     \
+public:                                                                                             \
+    static const char* zenixEntityName() { return #Type; }                                          \
+    static const char* zenixFieldNames() { return #__VA_ARGS__; }                                   \
+    auto zenixFields() { return std::tie(__VA_ARGS__); }                                            \
+    auto zenixFields() const { return std::tie(__VA_ARGS__); }                                      \
+    std::string getEntityName() const override { return #Type; }                                    \
+    std::string getId() const override { return EntityReflection::idToString(std::get<0>(zenixFields())); } \
+    void setId(const std::string& value) override { EntityReflection::assignText(std::get<0>(zenixFields()), value); } \
+    std::any getFieldValue(const std::string& fieldName) const override {                          \
+        return EntityReflection::getField(*this, fieldName);                                        \
+    }                                                                                               \
+    void setFieldValue(const std::string& fieldName, const std::string& value) override {          \
+        EntityReflection::setField(*this, fieldName, value);                                        \
+    }
+
+// ZENIX_ENTITY가 선언한 멤버 목록으로 매핑과 필드 접근자를 만듭니다.
+// 지원 타입: 정수(bool 포함), 부동소수점, std::string, Blob
+class EntityReflection {
+public:
+    // 컬럼 이름은 멤버 이름과 같습니다. 다르면 반환된 매핑의 columnName/idColumnName을 수정한 뒤 등록합니다.
+    template <typename T>
+    static EntityMapping makeMapping(const std::string& tableName) {
+        static_assert(std::is_base_of_v<IEntity, T>, "ZENIX_ENTITY type must derive from IEntity");
+        constexpr size_t count = std::tuple_size_v<decltype(std::declval<T&>().zenixFields())>;
+        static_assert(count > 0, "ZENIX_ENTITY requires at least the id member");
+
+        std::vector<std::string> names = splitNames(T::zenixFieldNames());
+        EntityMapping mapping;
+        mapping.entityName = T::zenixEntityName();
+        mapping.tableName = tableName;
+        mapping.idColumnName = names[0];
+        mapping.idAccessor = makeAccessor<T, 0>();
+        mapping.entityConstructor = []() -> std::shared_ptr<IEntity> { return std::make_shared<T>(); };
+        addFields<T>(mapping, names, std::make_index_sequence<count>());
+        return mapping;
+    }
+
+    // 이하 ZENIX_ENTITY가 생성한 코드에서 사용합니다.
+
+    template <typename M>
+    static std::string idToString(const M& value) {
+        if constexpr (std::is_arithmetic_v<M>) {
+            // SQLite rowid는 1부터 시작하므로 0은 아직 저장되지 않은 엔티티입니다.
+            return value == M() ? std::string() : toText(value);
+        } else {
+            return toText(value);
+        }
+    }
+
+    template <typename M>
+    static void assignText(M& member, const std::string& text) {
+        ColumnValue value;
+        value.type = text.empty() ? ColumnType::Null : ColumnType::Text;
+        value.text = text;
+        assign(member, value);
+    }
+
+    template <typename T>
+    static std::any getField(const T& entity, const std::string& fieldName) {
+        std::any result;
+        bool found = false;
+        forEachField(entity.zenixFields(), T::zenixFieldNames(), [&](const std::string& name, const auto& member) {
+            if (!found && name == fieldName) {
+                result = member;
+                found = true;
+            }
+        });
+        if (!found) {
+            throw MappingException("Unknown field: " + fieldName);
+        }
+        return result;
+    }
+
+    template <typename T>
+    static void setField(T& entity, const std::string& fieldName, const std::string& text) {
+        bool found = false;
+        forEachField(entity.zenixFields(), T::zenixFieldNames(), [&](const std::string& name, auto& member) {
+            if (!found && name == fieldName) {
+                assignText(member, text);
+                found = true;
+            }
+        });
+        if (!found) {
+            throw MappingException("Unknown field: " + fieldName);
+        }
+    }
+
+private:
+    template <typename M>
+    static constexpr ColumnType columnTypeOf() {
+        static_assert(std::is_arithmetic_v<M> || std::is_same_v<M, std::string> || std::is_same_v<M, Blob>,
+                      "Unsupported ZENIX_ENTITY member type");
+        if constexpr (std::is_integral_v<M>) {
+            return ColumnType::Integer;
+        } else if constexpr (std::is_floating_point_v<M>) {
+            return ColumnType::Real;
+        } else if constexpr (std::is_same_v<M, std::string>) {
+            return ColumnType::Text;
+        } else {
+            return ColumnType::Blob;
+        }
+    }
+
+    template <typename T, size_t I>
+    using MemberType = std::decay_t<std::tuple_element_t<I, decltype(std::declval<T&>().zenixFields())>>;
+
+    template <typename T, size_t I>
+    static FieldAccessor makeAccessor() {
+        FieldAccessor accessor;
+        accessor.type = columnTypeOf<MemberType<T, I>>();
+        accessor.read = [](const IEntity& entity) -> SQLParameter {
+            return toParameter(std::get<I>(static_cast<const T&>(entity).zenixFields()));
+        };
+        accessor.write = [](IEntity& entity, const ColumnValue& value) {
+            assign(std::get<I>(static_cast<T&>(entity).zenixFields()), value);
+        };
+        return accessor;
+    }
+
+    template <typename T, size_t... I>
+    static void addFields(EntityMapping& mapping, const std::vector<std::string>& names, std::index_sequence<I...>) {
+        // 0번(ID)을 제외한 멤버를 순서대로 추가합니다.
+        mapping.fields.reserve(sizeof...(I) - 1);
+        (void)std::initializer_list<int>{
+            (I == 0 ? 0 : (mapping.fields.push_back(FieldMapping{names[I], names[I], makeAccessor<T, I>()}), 0))...};
+    }
+
+    template <typename M>
+    static SQLParameter toParameter(const M& member) {
+        if constexpr (std::is_integral_v<M>) {
+            return static_cast<int64_t>(member);
+        } else if constexpr (std::is_floating_point_v<M>) {
+            return static_cast<double>(member);
+        } else if constexpr (std::is_same_v<M, std::string>) {
+            return std::string_view(member);
+        } else {
+            return BlobView{member.data(), member.size()};
+        }
+    }
+
+    template <typename M>
+    static void assign(M& member, const ColumnValue& value) {
+        if constexpr (std::is_arithmetic_v<M>) {
+            switch (value.type) {
+                case ColumnType::Integer:
+                    member = static_cast<M>(value.integer);
+                    break;
+                case ColumnType::Real:
+                    member = static_cast<M>(value.real);
+                    break;
+                case ColumnType::Text: {
+                    // 숫자 컬럼에 텍스트가 저장된 경우만 변환합니다. (SQLite 타입 친화성)
+                    std::string text(value.text);
+                    if constexpr (std::is_integral_v<M>) {
+                        member = static_cast<M>(std::strtoll(text.c_str(), nullptr, 10));
+                    } else {
+                        member = static_cast<M>(std::strtod(text.c_str(), nullptr));
+                    }
+                    break;
+                }
+                default:
+                    member = M();
+                    break;
+            }
+        } else if constexpr (std::is_same_v<M, std::string>) {
+            if (value.type == ColumnType::Text || value.type == ColumnType::Blob) {
+                member.assign(value.text.data(), value.text.size());
+            } else {
+                member = value.toString();
+            }
+        } else {
+            member.assign(reinterpret_cast<const uint8_t*>(value.text.data()),
+                          reinterpret_cast<const uint8_t*>(value.text.data()) + value.text.size());
+        }
+    }
+
+    template <typename M>
+    static std::string toText(const M& member) {
+        if constexpr (std::is_arithmetic_v<M>) {
+            return std::to_string(member);
+        } else if constexpr (std::is_same_v<M, std::string>) {
+            return member;
+        } else {
+            return std::string(member.begin(), member.end());
+        }
+    }
+
+    static std::vector<std::string> splitNames(const char* list) {
+        std::vector<std::string> names;
+        std::string current;
+        for (const char* p = list;; ++p) {
+            if (*p == ',' || *p == '\0') {
+                names.push_back(current);
+                current.clear();
+                if (*p == '\0') {
+                    break;
+                }
+            } else if (*p != ' ' && *p != '\t' && *p != '\n') {
+                current += *p;
+            }
+        }
+        return names;
+    }
+
+    // 문자열 기반 IEntity 메서드용 (느린 경로)
+    template <typename Tuple, typename F>
+    static void forEachField(Tuple&& fields, const char* list, F&& visit) {
+        std::vector<std::string> names = splitNames(list);
+        std::apply([&](auto&... member) {
+            size_t index = 0;
+            (visit(names[index++], member), ...);
+        }, fields);
+    }
+};
+
+#endif // ENTITY_REFLECTION_H
@@ -3,6 +3,8 @@
 
 #include <string>
 #include <any>
+#include <memory>
+#include "LazyRelation.h"
 
 class IEntity {
 public:
@@ -13,6 +15,16 @@ public:
     virtual void setId(const std::string& id) = 0;
     virtual std::any getFieldValue(const std::string& fieldName) const = 0;
     virtual void setFieldValue(const std::string& fieldName, const std::string& value) = 0;
+
+    // EntityMapping::relationships에 선언된 관계를 지연 로딩합니다.
+    // 쿼리 결과로 만들어진 엔티티만 로드할 수 있으며, 그 외에는 LazyInitializationException을 던집니다.
+    LazyRelation relation(const std::string& relationName) const;
+    // 쿼리가 결과 엔티티를 일괄 로딩 그룹에 연결합니다.
+    void attachFetchGroup(std::shared_ptr<FetchGroup> group, size_t index);
+
+private:
+    std::shared_ptr<FetchGroup> fetchGroup;
+    size_t fetchIndex = 0;
 };
 
 #endif // IENTITY_H
\ No newline at end of file
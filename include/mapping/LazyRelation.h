@@ -0,0 +1,29 @@
+#ifndef LAZY_RELATION_H
+#define LAZY_RELATION_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+class IEntity;
+class FetchGroup;
+
+// 엔티티 관계의 지연 로딩 프록시 (IEntity::relation으로 얻음).
+// 처음 접근하면 같은 쿼리 결과에 속한 모든 엔티티의 같은 관계를 일괄 조회(WHERE ... IN)합니다.
+class LazyRelation {
+public:
+    LazyRelation(std::shared_ptr<FetchGroup> group, size_t index, std::string relationName);
+
+    // 관계의 엔티티 목록 (OneToMany 등)
+    std::vector<std::shared_ptr<IEntity>> get() const;
+    // 단일 관계의 엔티티 (ManyToOne/OneToOne). 없으면 nullptr
+    std::shared_ptr<IEntity> getOne() const;
+    bool isLoaded() const;
+
+private:
+    std::shared_ptr<FetchGroup> group;
+    size_t index;
+    std::string relationName;
+};
+
+#endif // LAZY_RELATION_H
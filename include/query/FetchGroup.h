@@ -0,0 +1,109 @@
+#ifndef FETCH_GROUP_H
+#define FETCH_GROUP_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "database/IDatabaseConnection.h"
+#include "../mapping/EntityMapper.h"
+#include "utils/logger/Logger.h"
+
+class QueryCursor;
+
+// 지연 로딩에 필요한 쿼리 실행 환경 (세션이 쿼리에 설정)
+struct FetchContext {
+    static constexpr size_t DEFAULT_BATCH_SIZE = 100;
+
+    std::weak_ptr<const void> sessionLifetime; // 세션이 닫히면 만료
+    bool sessionBound = false;                 // false이면 연결을 쿼리가 소유한 것으로 봄
+    // 세션의 현재 연결 (닫혔으면 nullptr). 세션에 묶인 그룹은 연결을 붙잡지 않고 로드할 때마다 세션에서 얻습니다.
+    std::function<std::shared_ptr<IDatabaseConnection>()> sessionConnection;
+    size_t batchSize = DEFAULT_BATCH_SIZE;     // IN 목록 하나에 넣을 키 수
+    // fetchJoin으로 함께 읽은 엔티티를 세션의 1차 캐시에 등록합니다. 같은 ID의 인스턴스가 이미 있으면 그것을 반환합니다.
+    std::function<std::shared_ptr<IEntity>(const EntityMapping&, const std::shared_ptr<IEntity>&)> identityMap;
+    // stream()으로 연 커서를 세션에 등록합니다. 세션이 닫히면 아직 열린 커서를 무효화합니다.
+    std::function<void(const std::shared_ptr<QueryCursor>&)> trackCursor;
+};
+
+// fetchJoin으로 루트 엔티티와 함께 LEFT JOIN 한 번에 읽는 관계 (QueryBuilder가 생성)
+struct JoinFetch {
+    size_t relationIndex;                        // 루트 매핑의 relationships 인덱스
+    std::shared_ptr<const EntityMapping> target; // 관계 대상 매핑
+    std::string columnPrefix;                    // 대상 컬럼의 결과 별칭 접두사 (예: "zj0__")
+};
+
+// 한 번의 쿼리 결과로 만들어진 엔티티 묶음.
+// 어떤 엔티티의 관계에 처음 접근하면 묶음 전체의 같은 관계를 IN 쿼리로 한 번에 읽어
+// N+1 쿼리를 피합니다. 소유 엔티티는 참조하지 않고 ID와 외래 키 값만 보관합니다.
+// 세션의 1차 캐시에서 가져온 관계 엔티티는 약한 참조로 보관해 엔티티 -> 그룹 -> 엔티티 순환을 만들지 않습니다.
+class FetchGroup {
+public:
+    FetchGroup(std::shared_ptr<const EntityMapping> mapping, std::shared_ptr<IDatabaseConnection> connection,
+               FetchContext context);
+
+    // 결과 컬럼 이름으로 외래 키(joinColumn) 컬럼 위치를 정합니다. add 전에 한 번 호출합니다.
+    void setResultColumns(const std::vector<std::string>& columnNames);
+
+    // 엔티티를 묶음에 추가하고 연결합니다. readValue(columnIndex)는 현재 행의 ColumnValue를 반환합니다.
+    // 반환값은 묶음 안에서의 엔티티 인덱스입니다.
+    template <typename ValueReader>
+    size_t add(const std::shared_ptr<IEntity>& entity, ValueReader&& readValue) {
+        size_t index = ids.size();
+        ids.push_back(entity->getId());
+        for (size_t r = 0; r < foreignKeyColumns.size(); ++r) {
+            int column = foreignKeyColumns[r];
+            foreignKeys[r].push_back(column >= 0 ? readValue(static_cast<size_t>(column)).toString() : std::string());
+        }
+        entity->attachFetchGroup(owner.lock(), index);
+        return index;
+    }
+
+    // 조인으로 이미 읽은 index번째 엔티티의 관계를 기록합니다. (related가 nullptr이면 관계 없음)
+    // sessionOwned이면 related는 세션의 1차 캐시가 소유한 인스턴스이므로 약한 참조로 보관합니다.
+    void setFetched(size_t relationIndex, size_t index, std::shared_ptr<IEntity> related, bool sessionOwned);
+
+    // index번째 엔티티의 관계. 아직 로드되지 않았으면 묶음 전체를 일괄 로드합니다.
+    std::vector<std::shared_ptr<IEntity>> getRelated(size_t index, const std::string& relationName);
+    bool isLoaded(const std::string& relationName) const;
+
+    // 그룹을 생성합니다. (엔티티가 그룹을 참조하도록 shared_ptr로만 생성)
+    static std::shared_ptr<FetchGroup> create(std::shared_ptr<const EntityMapping> mapping,
+                                              std::shared_ptr<IDatabaseConnection> connection, FetchContext context);
+
+    // 외래 키가 소유 엔티티 테이블에 있는 관계인지 (ManyToOne, mappedBy가 없는 OneToOne)
+    static bool ownsForeignKey(const Relationship& relationship);
+    // 반대쪽 관계(OneToMany, mappedBy가 있는 OneToOne)에서 대상 테이블의 외래 키 컬럼
+    static std::string inverseJoinColumn(const EntityMapping& owner, const Relationship& relationship,
+                                         const EntityMapping& target);
+
+private:
+    // 관계 엔티티 하나. 그룹이 만든 엔티티는 owned, 세션 캐시의 엔티티는 shared로 보관합니다.
+    struct RelatedEntity {
+        std::shared_ptr<IEntity> owned;
+        std::weak_ptr<IEntity> shared;
+    };
+    using RelatedLists = std::vector<std::vector<RelatedEntity>>;
+
+    void load(size_t relationIndex);
+    // 결과에 외래 키 컬럼이 없었으면 소유 테이블에서 ID로 일괄 조회합니다.
+    void fetchForeignKeys(IDatabaseConnection& connection, size_t relationIndex);
+    size_t maxKeysPerQuery(IDatabaseConnection& connection) const;
+    // 로드에 사용할 연결. 세션에 묶인 그룹은 세션에서 얻고, 세션이 닫혔으면 LazyInitializationException
+    std::shared_ptr<IDatabaseConnection> acquireConnection(const std::string& relationName) const;
+
+    std::weak_ptr<FetchGroup> owner;
+    std::shared_ptr<const EntityMapping> mapping;
+    std::shared_ptr<IDatabaseConnection> connection; // 세션에 묶이지 않은 그룹만 보관
+    FetchContext context;
+    Logger& logger;
+
+    std::vector<std::string> ids;                      // 엔티티 ID (추가 순서)
+    std::vector<int> foreignKeyColumns;                // 관계별 결과 컬럼 위치 (-1이면 없음)
+    std::vector<std::vector<std::string>> foreignKeys; // [관계][엔티티] 외래 키 값 ("" = NULL)
+    std::vector<bool> foreignKeysFetched;              // 결과에 없던 외래 키를 조회했는지
+    std::unordered_map<size_t, RelatedLists> loaded;   // 관계 인덱스 -> 엔티티별 관계 엔티티
+};
+
+#endif // FETCH_GROUP_H
@@ -4,22 +4,50 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <type_traits>
+#include <future>
 #include "IEntity.h"
-#include <map>
+#include "database/SQLParameter.h"
+#include "IQueryCursor.h"
+#include "database/ResultSet.h"
 
 class IQuery {
 public:
     virtual ~IQuery() = default;
 
-    // 파라미터 설정
-    virtual void setParameter(const std::string& name, const std::string& value) = 0;
+    // 파라미터 설정 (이름 기반, 타입별 바인딩)
+    virtual void setParameterValue(const std::string& name, SQLParameter value) = 0;
+
+    void setParameter(const std::string& name, const std::string& value) { setParameterValue(name, value); }
+    void setParameter(const std::string& name, std::string&& value) { setParameterValue(name, std::move(value)); }
+    void setParameter(const std::string& name, const char* value) { setParameterValue(name, std::string(value)); }
+    // 호출자가 쿼리 실행이 끝날 때까지 참조 대상의 수명을 보장해야 합니다. (복사 없음)
+    void setParameter(const std::string& name, std::string_view value) { setParameterValue(name, value); }
+    void setParameter(const std::string& name, const Blob& value) { setParameterValue(name, value); }
+    void setParameter(const std::string& name, BlobView value) { setParameterValue(name, value); }
+    void setParameter(const std::string& name, std::nullptr_t) { setParameterValue(name, nullptr); }
+    void setParameter(const std::string& name, bool value) { setParameterValue(name, static_cast<int64_t>(value ? 1 : 0)); }
+
+    template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, int>::type = 0>
+    void setParameter(const std::string& name, T value) { setParameterValue(name, static_cast<int64_t>(value)); }
+
+    template <typename T, typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>
+    void setParameter(const std::string& name, T value) { setParameterValue(name, static_cast<double>(value)); }
+
+    // list()/listMap() 결과를 쿼리 결과 캐시에 저장하고 재사용할지 설정 (기본값: false)
+    virtual void setCacheable(bool cacheable) = 0;
 
     // 쿼리 실행
     virtual std::vector<std::shared_ptr<IEntity>> list() = 0;
     virtual std::shared_ptr<IEntity> uniqueResult() = 0;
+    // 호출 시점의 파라미터로 작업자 스레드에서 list()를 실행합니다.
+    virtual std::future<std::vector<std::shared_ptr<IEntity>>> listAsync() = 0;
+
+    // 결과를 엔티티가 아닌 ResultSet으로 반환 (필요한 경우)
+    virtual ResultSet listMap() = 0;
 
-    // 결과를 엔티티가 아닌 맵으로 반환 (필요한 경우)
-    virtual std::vector<std::map<std::string, std::string>> listMap() = 0;
+    // 결과를 전부 적재하지 않고 한 행씩 읽는 커서를 반환
+    virtual std::shared_ptr<IQueryCursor> stream() = 0;
 };
 
 #endif // IQUERY_H
\ No newline at end of file
@@ -15,6 +15,8 @@ public:
     virtual IQueryBuilder& orderBy(const std::string& field, const std::string& order = "ASC") = 0;
     virtual IQueryBuilder& limit(int limit) = 0;
     virtual IQueryBuilder& offset(int offset) = 0;
+    // 관계(ManyToOne/OneToOne)를 LEFT JOIN으로 루트 엔티티와 함께 조회합니다.
+    virtual IQueryBuilder& fetchJoin(const std::string& relationName) = 0;
 
     virtual std::shared_ptr<IQuery> getQuery() = 0;
 };
@@ -0,0 +1,40 @@
+#ifndef IQUERY_CURSOR_H
+#define IQUERY_CURSOR_H
+
+#include <string>
+#include <string_view>
+#include <memory>
+#include <cstdint>
+#include "IEntity.h"
+#include "database/ResultSet.h"
+
+// 쿼리 결과를 한 행씩 읽는 전방향 커서.
+// 커서가 끝까지 소비되거나 닫히기 전까지 연결과 준비된 문을 점유합니다.
+class IQueryCursor {
+public:
+    virtual ~IQueryCursor() = default;
+
+    // 다음 행으로 이동합니다. 더 이상 행이 없으면 false를 반환합니다.
+    virtual bool next() = 0;
+    // 커서를 닫고 준비된 문을 반납합니다. (조기 종료)
+    virtual void close() = 0;
+
+    // 현재 행을 엔티티로 변환
+    virtual std::shared_ptr<IEntity> getEntity() = 0;
+
+    // 현재 행의 컬럼 접근
+    virtual size_t columnCount() const = 0;
+    virtual const std::string& getColumnName(size_t column) const = 0;
+    virtual int findColumn(const std::string& name) const = 0;
+    virtual ColumnType getType(size_t column) const = 0;
+    virtual bool isNull(size_t column) const = 0;
+    virtual int64_t getInt64(size_t column) const = 0;
+    virtual double getDouble(size_t column) const = 0;
+    // 반환된 값은 다음 next() 호출 전까지만 유효합니다.
+    virtual std::string_view getText(size_t column) const = 0;
+    virtual std::string getString(size_t column) const = 0;
+    // 현재 행의 셀 값을 변환 없이 반환합니다. TEXT/BLOB은 다음 next() 전까지 유효합니다.
+    virtual ColumnValue getValue(size_t column) const = 0;
+};
+
+#endif // IQUERY_CURSOR_H
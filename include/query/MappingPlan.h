@@ -0,0 +1,71 @@
+#ifndef MAPPING_PLAN_H
+#define MAPPING_PLAN_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "../mapping/EntityMapper.h"
+
+// 결과 컬럼 인덱스 -> 엔티티 필드 매핑 계획.
+// 준비된 문(또는 캐시된 결과)마다 한 번 만들고, 행마다 컬럼 수만큼만 순회합니다.
+struct MappingPlan {
+    enum class Target {
+        Skip,
+        Id,
+        Field,
+    };
+
+    struct Column {
+        Target target;
+        const FieldMapping* field; // mapping->fields 내부를 가리킴
+    };
+
+    std::shared_ptr<const EntityMapping> mapping;
+    std::vector<Column> columns;
+
+    // 결과 컬럼 이름이 매핑의 컬럼 이름과 같을 때 (예: SELECT * FROM t) 이름만으로 계획을 만듭니다.
+    static std::shared_ptr<MappingPlan> forColumns(std::shared_ptr<const EntityMapping> mapping,
+                                                   const std::vector<std::string>& columnNames) {
+        auto plan = std::make_shared<MappingPlan>();
+        plan->columns.reserve(columnNames.size());
+        for (const auto& name : columnNames) {
+            if (name == mapping->idColumnName) {
+                plan->columns.push_back({Target::Id, nullptr});
+                continue;
+            }
+            const FieldMapping* match = nullptr;
+            for (const auto& field : mapping->fields) {
+                if (field.columnName == name) {
+                    match = &field;
+                    break;
+                }
+            }
+            plan->columns.push_back({match ? Target::Field : Target::Skip, match});
+        }
+        plan->mapping = std::move(mapping);
+        return plan;
+    }
+
+    // readValue(columnIndex)가 반환하는 ColumnValue로 엔티티를 생성합니다.
+    // ZENIX_ENTITY 필드는 멤버에 직접 대입하고, 그 외에는 문자열로 변환해 setFieldValue를 호출합니다.
+    template <typename ValueReader>
+    std::shared_ptr<IEntity> materialize(ValueReader&& readValue) const {
+        auto entity = mapping->entityConstructor();
+        for (size_t i = 0; i < columns.size(); ++i) {
+            const Column& column = columns[i];
+            switch (column.target) {
+                case Target::Id:
+                    mapping->assignId(*entity, readValue(i));
+                    break;
+                case Target::Field:
+                    column.field->assign(*entity, readValue(i));
+                    break;
+                default:
+                    break;
+            }
+        }
+        return entity;
+    }
+};
+
+#endif // MAPPING_PLAN_H
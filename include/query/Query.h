@@ -2,8 +2,12 @@
 #define QUERY_H
 
 #include "IQuery.h"
+#include "QueryCursor.h"
+#include "FetchGroup.h"
 #include "database/DatabaseConnectionFactory.h"
 #include "../mapping/EntityMapper.h"
+#include "../cache/QueryResultCache.h"
+#include "../core/AsyncExecutor.h"
 #include "utils/logger/Logger.h"
 #include "ORMException/ORMException.h"
 #include <unordered_map>
@@ -14,29 +18,55 @@ public:
     Query(std::shared_ptr<IDatabaseConnection> connection, const std::string& queryString);
     virtual ~Query();
 
-    void setParameter(const std::string& name, const std::string& value) override;
+    void setParameterValue(const std::string& name, SQLParameter value) override;
+    void setCacheable(bool cacheable) override;
 
     std::vector<std::shared_ptr<IEntity>> list() override;
     std::shared_ptr<IEntity> uniqueResult() override;
+    std::future<std::vector<std::shared_ptr<IEntity>>> listAsync() override;
 
-    std::vector<std::map<std::string, std::string>> listMap() override;
+    // listAsync()를 실행할 직렬 실행기 (세션이 설정, 없으면 AsyncExecutor에서 바로 실행)
+    void setAsyncStrand(std::shared_ptr<AsyncStrand> strand);
+    // 결과 엔티티의 관계를 지연 로딩할 때 사용할 세션 수명과 일괄 조회 크기 (세션이 설정)
+    void setFetchContext(FetchContext context);
+    // 결과 행마다 root 엔티티와 함께 만들 조인 관계 (QueryBuilder::fetchJoin이 설정)
+    void setJoinFetches(std::shared_ptr<const EntityMapping> root, std::vector<JoinFetch> joins);
+
+    ResultSet listMap() override;
+
+    std::shared_ptr<IQueryCursor> stream() override;
 
 private:
     std::shared_ptr<IDatabaseConnection> connection;
     std::string queryString;
-    std::unordered_map<std::string, std::string> parameters;
+    // 열린 커서가 바인딩된 값을 공유하므로 변경 시에는 복사본을 만듭니다. (copy-on-write)
+    using ParameterMap = std::unordered_map<std::string, SQLParameter>;
+    std::shared_ptr<ParameterMap> parameters;
+    bool cacheable;
+    std::shared_ptr<AsyncStrand> asyncStrand;
+    FetchContext fetchContext;
+    std::shared_ptr<const EntityMapping> joinRoot;
+    std::vector<JoinFetch> joinFetches;
     Logger& logger;
 
-    // Prepared Statement 캐시
-    static std::unordered_map<std::string, sqlite3_stmt*> statementCache;
-    static std::mutex cacheMutex;
+    static const std::string PARAMETER_NAMES_KEY;
 
-    // SQLite3 전용: 준비된 문 (statement)
-    sqlite3_stmt* stmt;
+    // 연결의 Statement 캐시에서 문을 대여하고 파라미터를 바인딩한 커서를 여는 함수
+    std::shared_ptr<QueryCursor> openCursor();
+    // 문의 파라미터 인덱스 -> 이름 목록 (문마다 한 번만 계산)
+    std::shared_ptr<const std::vector<std::string>> getParameterNames(sqlite3_stmt* stmt);
+    // 결과 캐시 키 (캐시를 사용할 수 없으면 빈 문자열)
+    std::string resultCacheKey(const std::string& kind) const;
+    // 커서의 나머지 행을 ResultSet으로 읽는 함수
+    static ResultSet fetchAll(QueryCursor& cursor);
+    std::vector<std::shared_ptr<IEntity>> materialize(const ResultSet& rows, const MappingPlan& plan);
+    // 매핑에 관계가 있으면 결과 엔티티를 묶을 일괄 로딩 그룹을 만듭니다. (없으면 nullptr)
+    std::shared_ptr<FetchGroup> createFetchGroup(const std::shared_ptr<const EntityMapping>& mapping,
+                                                 const std::vector<std::string>& columnNames) const;
 
-    // 쿼리를 준비하고 파라미터를 바인딩하는 함수
-    void prepareAndBind();
-    void finalizeStatement();
+    // fetchJoin 결과의 한 행에서 루트 엔티티와 조인 관계 엔티티를 만드는 상태 (결과 집합마다 하나)
+    class JoinedRows;
+    std::shared_ptr<JoinedRows> createJoinedRows(const std::vector<std::string>& columnNames) const;
 };
 
 #endif // QUERY_H
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include "IQueryBuilder.h"
 #include "../database/IDatabaseConnection.h"
 #include "../utils/logger/Logger.h"
+#include "FetchGroup.h"
+#include "../core/AsyncExecutor.h"
+#include <vector>
 
 class QueryBuilder : public IQueryBuilder {
 public:
@@ -16,19 +19,34 @@ public:
     IQueryBuilder& orderBy(const std::string& field, const std::string& order = "ASC") override;
     IQueryBuilder& limit(int limit) override;
     IQueryBuilder& offset(int offset) override;
+    IQueryBuilder& fetchJoin(const std::string& relationName) override;
 
     std::shared_ptr<IQuery> getQuery() override;
 
+    // 생성하는 쿼리에 전달할 지연 로딩 설정 (세션이 설정)
+    void setFetchContext(FetchContext context);
+    // 생성하는 쿼리의 listAsync()를 실행할 직렬 실행기 (세션이 설정)
+    void setAsyncStrand(std::shared_ptr<AsyncStrand> strand);
+
 private:
     std::shared_ptr<IDatabaseConnection> connection;
+    FetchContext fetchContext;
+    std::shared_ptr<AsyncStrand> asyncStrand;
     Logger& logger;
 
     std::string selectClause;
     std::string fromClause;
+    std::string fromTable;
+    std::string fromAlias;
+    std::vector<std::string> fetchJoins; // fetchJoin으로 요청한 관계 이름 (요청 순서)
     std::string whereClause;
     std::string orderByClause;
     std::string limitClause;
     std::string offsetClause;
+
+    // fetchJoin 관계의 LEFT JOIN 절과 별칭이 붙은 대상 컬럼 목록을 만듭니다.
+    std::vector<JoinFetch> resolveFetchJoins(const EntityMapping& root, std::string& joinColumns,
+                                             std::string& joinClauses) const;
 };
 
 #endif // QUERY_BUILDER_H
\ No newline at end of file
@@ -0,0 +1,74 @@
+#ifndef QUERY_CURSOR_H
+#define QUERY_CURSOR_H
+
+#include "IQueryCursor.h"
+#include "database/IDatabaseConnection.h"
+#include "../mapping/EntityMapper.h"
+#include "MappingPlan.h"
+#include "utils/logger/Logger.h"
+#include <vector>
+#include <mutex>
+#include <sqlite3.h>
+
+class QueryCursor : public IQueryCursor {
+public:
+    // stmt는 connection의 캐시에서 대여해 바인딩까지 끝난 문이며, 커서가 반납을 책임집니다.
+    QueryCursor(std::shared_ptr<IDatabaseConnection> connection, sqlite3_stmt* stmt, const std::string& queryString);
+    virtual ~QueryCursor();
+
+    bool next() override;
+    void close() override;
+
+    std::shared_ptr<IEntity> getEntity() override;
+
+    size_t columnCount() const override;
+    const std::string& getColumnName(size_t column) const override;
+    int findColumn(const std::string& name) const override;
+    ColumnType getType(size_t column) const override;
+    bool isNull(size_t column) const override;
+    int64_t getInt64(size_t column) const override;
+    double getDouble(size_t column) const override;
+    std::string_view getText(size_t column) const override;
+    std::string getString(size_t column) const override;
+    ColumnValue getValue(size_t column) const override;
+
+    // 바인딩된 값의 수명을 커서가 살아있는 동안 유지합니다.
+    void retainParameters(std::shared_ptr<const void> values);
+    // 커서를 닫고 이후의 next()가 예외를 던지게 합니다. (세션이 닫힐 때 호출, 다른 스레드에서 호출 가능)
+    void invalidate();
+
+    // 결과 테이블에 대응하는 엔티티 매핑 (없으면 MappingException)
+    std::shared_ptr<const EntityMapping> getMapping();
+    // 컬럼 -> 필드 매핑 계획 (준비된 문에 캐시됨)
+    std::shared_ptr<const MappingPlan> getMappingPlan();
+    // 문이 읽는 테이블의 버전 키 목록 (수집되지 않았으면 nullptr)
+    std::shared_ptr<const std::vector<std::string>> getReadTables() const;
+    // 현재 행을 ResultSet에 추가합니다.
+    void appendRow(ResultSet& resultSet) const;
+    const std::vector<std::string>& getColumnNames() const;
+    // 컬럼 헤더만 가진 빈 ResultSet을 생성합니다.
+    ResultSet createResultSet() const;
+
+private:
+    static const std::string PLAN_ATTACHMENT_KEY;
+
+    std::shared_ptr<const MappingPlan> buildPlan();
+    void checkRow(size_t column) const;
+    // 문을 반납합니다. (cursorMutex 보유 상태에서 호출)
+    void releaseStatement();
+
+    std::shared_ptr<IDatabaseConnection> connection;
+    sqlite3_stmt* stmt;
+    std::string queryString;
+    Logger& logger;
+
+    std::vector<std::string> columnNames;
+    std::shared_ptr<const MappingPlan> plan;
+    std::shared_ptr<const void> boundValues;
+    bool hasRow;
+    size_t rowsFetched;
+    bool invalidated;       // 세션이 닫혀 더 이상 사용할 수 없음
+    std::mutex cursorMutex; // next/close와 세션의 invalidate 사이의 문 반납을 직렬화
+};
+
+#endif // QUERY_CURSOR_H
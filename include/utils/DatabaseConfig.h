@@ -1,28 +1,7 @@
-#ifndef DATABASE_CONFIG_H
-#define DATABASE_CONFIG_H
+#ifndef UTILS_DATABASE_CONFIG_H
+#define UTILS_DATABASE_CONFIG_H
 
-#include <string>
+// DatabaseConfig는 database/DatabaseConfig.h에 정의되어 있습니다. (기존 include 경로 호환용)
+#include "../database/DatabaseConfig.h"
 
-enum class DatabaseType {
-    SQLite,
-    // 향후 다른 데이터베이스 타입 추가 가능
-};
-
-class DatabaseConfig {
-public:
-    DatabaseConfig();
-
-    // 설정 메서드
-    void setDatabaseType(DatabaseType type);
-    void setDatabaseName(const std::string& name);
-
-    // Getter 메서드
-    DatabaseType getDatabaseType() const;
-    std::string getDatabaseName() const;
-
-private:
-    DatabaseType dbType;
-    std::string dbName;
-};
-
-#endif // DATABASE_CONFIG_H
\ No newline at end of file
+#endif // UTILS_DATABASE_CONFIG_H
@@ -2,11 +2,18 @@
 #define LOCK_ACQUISITION_EXCEPTION_H
 
 #include "DataAccessException.h"
+#include <cstddef>
 
 class LockAcquisitionException : public DataAccessException {
 public:
-    explicit LockAcquisitionException(const std::string& message);
+    // retryCount: 포기하기 전까지 재시도한 횟수
+    explicit LockAcquisitionException(const std::string& message, size_t retryCount = 0);
     virtual ~LockAcquisitionException() noexcept = default;
+
+    size_t getRetryCount() const;
+
+private:
+    size_t retryCount;
 };
 
 #endif // LOCK_ACQUISITION_EXCEPTION_H
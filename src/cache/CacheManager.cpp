@@ -1,4 +1,5 @@
 #include "CacheManager.h"
+#include <functional>
 
 CacheManager& CacheManager::getInstance() {
     static CacheManager instance;
@@ -7,29 +8,120 @@ CacheManager& CacheManager::getInstance() {
 
 CacheManager::CacheManager()
     : logger(Logger::getInstance()) {
+    configure(CacheConfig());
     logger.debug("CacheManager created.");
 }
 
+void CacheManager::configure(const CacheConfig& newConfig) {
+    config = newConfig;
+    if (config.shardCount == 0) {
+        config.shardCount = 1;
+    }
+
+    // 전체 한도를 샤드 수로 나누어 샤드별 한도를 정합니다. (올림)
+    size_t shardCapacity = config.maxEntries == 0
+        ? 0
+        : (config.maxEntries + config.shardCount - 1) / config.shardCount;
+
+    shards.clear();
+    shards.reserve(config.shardCount);
+    for (size_t i = 0; i < config.shardCount; ++i) {
+        auto shard = std::make_unique<Shard>();
+        shard->capacity = shardCapacity;
+        shards.push_back(std::move(shard));
+    }
+
+    logger.info("CacheManager configured: " + std::to_string(config.shardCount) + " shards, max entries: " +
+                std::to_string(config.maxEntries));
+}
+
+CacheManager::Shard& CacheManager::shardFor(const std::string& key) {
+    return *shards[std::hash<std::string>()(key) % shards.size()];
+}
+
+CacheManager::Clock::time_point CacheManager::expiryFor(const std::string& entityName) const {
+    auto ttl = config.defaultTTL;
+    auto it = config.entityTTL.find(entityName);
+    if (it != config.entityTTL.end()) {
+        ttl = it->second;
+    }
+    return ttl.count() > 0 ? Clock::now() + ttl : Clock::time_point::max();
+}
+
 void CacheManager::put(const std::string& key, const std::shared_ptr<IEntity>& entity) {
-    cache[key] = entity;
+    if (!entity) {
+        return;
+    }
+
+    auto expiresAt = expiryFor(entity->getEntityName());
+    Shard& shard = shardFor(key);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (it != shard.index.end()) {
+            it->second->entity = entity;
+            it->second->expiresAt = expiresAt;
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+        } else {
+            shard.lru.push_front(Entry{key, entity, expiresAt});
+            shard.index[key] = shard.lru.begin();
+
+            // 한도를 넘으면 가장 오래 사용되지 않은 엔트리를 제거합니다.
+            if (shard.capacity > 0 && shard.lru.size() > shard.capacity) {
+                shard.index.erase(shard.lru.back().key);
+                shard.lru.pop_back();
+            }
+        }
+    }
     logger.debug("Entity cached: " + key);
 }
 
 std::shared_ptr<IEntity> CacheManager::get(const std::string& key) {
-    auto it = cache.find(key);
-    if (it != cache.end()) {
-        logger.debug("Entity retrieved from cache: " + key);
-        return it->second;
+    Shard& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.index.find(key);
+    if (it == shard.index.end()) {
+        return nullptr;
     }
-    return nullptr;
+
+    if (it->second->expiresAt <= Clock::now()) {
+        shard.lru.erase(it->second);
+        shard.index.erase(it);
+        return nullptr;
+    }
+
+    shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+    return it->second->entity;
 }
 
 void CacheManager::remove(const std::string& key) {
-    cache.erase(key);
+    Shard& shard = shardFor(key);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (it != shard.index.end()) {
+            shard.lru.erase(it->second);
+            shard.index.erase(it);
+        }
+    }
     logger.debug("Entity removed from cache: " + key);
 }
 
 void CacheManager::clear() {
-    cache.clear();
+    for (auto& shard : shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->lru.clear();
+        shard->index.clear();
+    }
     logger.debug("Cache cleared.");
-}
\ No newline at end of file
+}
+
+size_t CacheManager::size() const {
+    size_t total = 0;
+    for (const auto& shard : shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        total += shard->lru.size();
+    }
+    return total;
+}
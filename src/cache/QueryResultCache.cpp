@@ -0,0 +1,175 @@
+#include "QueryResultCache.h"
+#include "TableVersionRegistry.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+
+QueryResultCache& QueryResultCache::getInstance() {
+    static QueryResultCache instance;
+    return instance;
+}
+
+QueryResultCache::QueryResultCache()
+    : maxEntries(DEFAULT_MAX_ENTRIES), logger(Logger::getInstance()) {}
+
+void QueryResultCache::setMaxEntries(size_t newMaxEntries) {
+    std::lock_guard<std::mutex> lock(mutex);
+    maxEntries = newMaxEntries;
+    while (lru.size() > maxEntries) {
+        index.erase(lru.back().key);
+        lru.pop_back();
+    }
+}
+
+std::string QueryResultCache::normalizeSQL(const std::string& sql) {
+    std::string normalized;
+    normalized.reserve(sql.size());
+    char quote = '\0';
+    bool pendingSpace = false;
+    for (char c : sql) {
+        if (quote) {
+            normalized += c;
+            if (c == quote) {
+                quote = '\0';
+            }
+            continue;
+        }
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            pendingSpace = !normalized.empty();
+            continue;
+        }
+        if (pendingSpace) {
+            normalized += ' ';
+            pendingSpace = false;
+        }
+        if (c == '\'' || c == '"' || c == '`') {
+            quote = c;
+        }
+        normalized += c;
+    }
+    while (!normalized.empty() && (normalized.back() == ';' || normalized.back() == ' ')) {
+        normalized.pop_back();
+    }
+    return normalized;
+}
+
+namespace {
+
+// 값의 타입과 길이를 함께 기록하여 서로 다른 파라미터 조합이 같은 키가 되지 않도록 합니다.
+struct ParameterWriter {
+    std::string& out;
+
+    void bytes(char tag, const void* data, size_t size) const {
+        out += tag;
+        out += std::to_string(size);
+        out += ':';
+        out.append(static_cast<const char*>(data), size);
+    }
+
+    void operator()(std::nullptr_t) const { out += 'N'; }
+    void operator()(int64_t value) const { out += 'I' + std::to_string(value); }
+    void operator()(double value) const {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+        out += 'R';
+        out += buffer;
+    }
+    void operator()(const std::string& value) const { bytes('T', value.data(), value.size()); }
+    void operator()(std::string_view value) const { bytes('T', value.data(), value.size()); }
+    void operator()(const Blob& value) const { bytes('B', value.data(), value.size()); }
+    void operator()(BlobView value) const { bytes('B', value.data, value.size); }
+};
+
+} // namespace
+
+std::string QueryResultCache::makeKey(const std::string& kind, const std::string& database, const std::string& sql,
+                                      const std::unordered_map<std::string, SQLParameter>& parameters) {
+    std::vector<const std::pair<const std::string, SQLParameter>*> sorted;
+    sorted.reserve(parameters.size());
+    for (const auto& parameter : parameters) {
+        sorted.push_back(&parameter);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+
+    std::string key = kind + '\n' + database + '\n' + normalizeSQL(sql) + '\n';
+    ParameterWriter writer{key};
+    for (const auto* parameter : sorted) {
+        key += parameter->first;
+        key += '=';
+        std::visit(writer, parameter->second);
+        key += '\n';
+    }
+    return key;
+}
+
+TableVersions QueryResultCache::captureVersions(const std::vector<std::string>& tableKeys) {
+    TableVersionRegistry& registry = TableVersionRegistry::getInstance();
+    TableVersions versions;
+    versions.reserve(tableKeys.size());
+    for (const auto& tableKey : tableKeys) {
+        versions.emplace_back(tableKey, registry.getVersion(tableKey));
+    }
+    return versions;
+}
+
+bool QueryResultCache::isCurrent(const TableVersions& versions) {
+    TableVersionRegistry& registry = TableVersionRegistry::getInstance();
+    for (const auto& version : versions) {
+        if (registry.getVersion(version.first) != version.second) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<const CachedQueryResult> QueryResultCache::get(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(key);
+    if (it == index.end()) {
+        return nullptr;
+    }
+
+    // 읽은 테이블 중 하나라도 변경되었으면 엔트리를 제거합니다.
+    if (!isCurrent(it->second->versions)) {
+        lru.erase(it->second);
+        index.erase(it);
+        return nullptr;
+    }
+
+    lru.splice(lru.begin(), lru, it->second);
+    return it->second->result;
+}
+
+void QueryResultCache::put(const std::string& key, TableVersions versions, std::shared_ptr<const CachedQueryResult> result) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (maxEntries == 0 || !result) {
+        return;
+    }
+
+    auto it = index.find(key);
+    if (it != index.end()) {
+        it->second->versions = std::move(versions);
+        it->second->result = std::move(result);
+        lru.splice(lru.begin(), lru, it->second);
+        return;
+    }
+
+    lru.push_front(Entry{key, std::move(versions), std::move(result)});
+    index[key] = lru.begin();
+    if (lru.size() > maxEntries) {
+        index.erase(lru.back().key);
+        lru.pop_back();
+    }
+}
+
+void QueryResultCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    lru.clear();
+    index.clear();
+    logger.debug("Query result cache cleared.");
+}
+
+size_t QueryResultCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return lru.size();
+}
@@ -0,0 +1,22 @@
+#include "TableVersionRegistry.h"
+#include <mutex>
+
+TableVersionRegistry& TableVersionRegistry::getInstance() {
+    static TableVersionRegistry instance;
+    return instance;
+}
+
+std::string TableVersionRegistry::makeKey(const std::string& database, const std::string& table) {
+    return database + "|" + table;
+}
+
+uint64_t TableVersionRegistry::getVersion(const std::string& tableKey) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto it = versions.find(tableKey);
+    return it != versions.end() ? it->second : 0;
+}
+
+void TableVersionRegistry::bump(const std::string& tableKey) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    ++versions[tableKey];
+}
@@ -1,53 +1,169 @@
 #include "ConnectionPool.h"
 #include "DatabaseConnectionFactory.h"
+#include "ORMException/DataAccessException/DatabaseConnectionException/DatabaseConnectionException.h"
+#include <algorithm>
 
-ConnectionPool::ConnectionPool(const DatabaseConfig& config, size_t initialSize, size_t maxSize)
-    : config(config), maxPoolSize(maxSize), currentPoolSize(0) {
-    for (size_t i = 0; i < initialSize; ++i) {
-        auto connection = createNewConnection();
-        connections.push(connection);
+constexpr std::chrono::milliseconds ConnectionPool::GROWTH_WAIT_THRESHOLD;
+
+ConnectionPool::ConnectionPool(const DatabaseConfig& config, size_t minSize, size_t maxSize)
+    : config(config), minPoolSize(std::min(minSize, std::max<size_t>(maxSize, 1))),
+      maxPoolSize(std::max<size_t>(maxSize, 1)), connectionTimeout(config.getConnectionTimeout()),
+      idleTimeout(config.getIdleTimeout()), logger(Logger::getInstance()), currentPoolSize(0),
+      waitingThreads(0), averageWait(0) {
+    auto now = Clock::now();
+    for (size_t i = 0; i < minPoolSize; ++i) {
+        connections.push_back(IdleConnection{createNewConnection(), now});
+        ++currentPoolSize;
     }
 }
 
 ConnectionPool::~ConnectionPool() {
     std::lock_guard<std::mutex> lock(poolMutex);
-    while (!connections.empty()) {
-        auto connection = connections.front();
-        connections.pop();
-        connection->disconnect();
+    for (auto& idle : connections) {
+        idle.connection->disconnect();
     }
+    connections.clear();
 }
 
 std::shared_ptr<IDatabaseConnection> ConnectionPool::createNewConnection() {
     auto connection = DatabaseConnectionFactory::createConnection(config);
     connection->connect();
-    ++currentPoolSize;
     return connection;
 }
 
+void ConnectionPool::discardConnection(const std::shared_ptr<IDatabaseConnection>& connection) {
+    try {
+        connection->disconnect();
+    } catch (const std::exception& e) {
+        logger.warn(std::string("Failed to close pooled connection: ") + e.what());
+    }
+}
+
+void ConnectionPool::collectIdleConnections(std::vector<std::shared_ptr<IDatabaseConnection>>& expired) {
+    if (idleTimeout.count() <= 0) {
+        return;
+    }
+    // 앞쪽이 가장 오래 쉬고 있는 연결입니다.
+    auto deadline = Clock::now() - idleTimeout;
+    while (currentPoolSize > minPoolSize && !connections.empty() && connections.front().idleSince < deadline) {
+        expired.push_back(std::move(connections.front().connection));
+        connections.pop_front();
+        --currentPoolSize;
+    }
+}
+
+void ConnectionPool::recordWait(Clock::duration wait) {
+    // 최근 값에 1/8 가중치를 두는 지수 이동 평균
+    auto sample = std::chrono::duration_cast<std::chrono::microseconds>(wait);
+    averageWait += (sample - averageWait) / 8;
+}
+
 std::shared_ptr<IDatabaseConnection> ConnectionPool::acquireConnection() {
-    std::unique_lock<std::mutex> lock(poolMutex);
+    auto start = Clock::now();
+    auto timeout = start + connectionTimeout;
+    std::vector<std::shared_ptr<IDatabaseConnection>> expired;
+
+    while (true) {
+        std::shared_ptr<IDatabaseConnection> connection;
+        bool create = false;
+        {
+            std::unique_lock<std::mutex> lock(poolMutex);
+            collectIdleConnections(expired);
+
+            bool waited = false;
+            while (connections.empty()) {
+                bool canGrow = currentPoolSize < maxPoolSize;
+                // 최소 크기 미만이거나 최근 대기 시간이 길면 바로 늘리고,
+                // 그렇지 않으면 짧게 반납을 기다려 순간적인 몰림에 연결을 늘리지 않습니다.
+                if (canGrow && (currentPoolSize < minPoolSize || averageWait >= GROWTH_WAIT_THRESHOLD || waited)) {
+                    break;
+                }
+
+                auto waitUntil = canGrow ? std::min(timeout, Clock::now() + GROWTH_WAIT_THRESHOLD) : timeout;
+                ++waitingThreads;
+                bool signalled = condition.wait_until(lock, waitUntil) == std::cv_status::no_timeout;
+                --waitingThreads;
+                if (!signalled && Clock::now() >= timeout && connections.empty()) {
+                    recordWait(Clock::now() - start);
+                    throw DatabaseConnectionException("Failed to acquire connection: Timeout after " +
+                                                      std::to_string(connectionTimeout.count()) + " ms.");
+                }
+                waited = waited || !signalled;
+            }
+
+            if (!connections.empty()) {
+                // 가장 최근에 반납된 연결을 사용하여 Statement 캐시가 따뜻한 연결을 우선합니다.
+                connection = std::move(connections.back().connection);
+                connections.pop_back();
+            } else {
+                // 자리를 먼저 예약하고 연결은 잠금 밖에서 엽니다.
+                ++currentPoolSize;
+                create = true;
+            }
+            recordWait(Clock::now() - start);
+        }
 
-    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
-    while (connections.empty()) {
-        if (currentPoolSize < maxPoolSize) {
-            // 동적으로 새로운 연결을 생성합니다.
-            auto connection = createNewConnection();
+        for (auto& stale : expired) {
+            discardConnection(stale);
+        }
+        expired.clear();
+
+        if (create) {
+            try {
+                connection = createNewConnection();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(poolMutex);
+                --currentPoolSize;
+                condition.notify_one();
+                throw;
+            }
+            logger.debug("Connection pool grew to " + std::to_string(getStats().totalConnections) + " connections.");
+            return connection;
+        }
+
+        // 대여 시 상태 확인. 사용할 수 없는 연결은 버리고 다시 시도합니다.
+        if (connection->isValid()) {
             return connection;
+        }
+        logger.warn("Discarding invalid pooled connection.");
+        discardConnection(connection);
+        {
+            // 자리가 비었으므로 최대 크기에 막혀 기다리던 스레드가 새 연결을 열 수 있게 깨웁니다.
+            std::lock_guard<std::mutex> lock(poolMutex);
+            --currentPoolSize;
+            condition.notify_one();
+        }
+    }
+}
+
+void ConnectionPool::releaseConnection(std::shared_ptr<IDatabaseConnection> connection) {
+    if (!connection) {
+        return;
+    }
+
+    bool valid = connection->isValid();
+    std::vector<std::shared_ptr<IDatabaseConnection>> expired;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        if (valid) {
+            connections.push_back(IdleConnection{connection, Clock::now()});
         } else {
-            if (condition.wait_until(lock, timeout) == std::cv_status::timeout) {
-                throw std::runtime_error("Failed to acquire connection: Timeout after 10 seconds.");
-            }
+            --currentPoolSize;
         }
+        collectIdleConnections(expired);
+        condition.notify_one();
     }
 
-    auto connection = connections.front();
-    connections.pop();
-    return connection;
+    if (!valid) {
+        logger.warn("Released connection is not reusable. Closing it.");
+        discardConnection(connection);
+    }
+    for (auto& stale : expired) {
+        discardConnection(stale);
+    }
 }
 
-void ConnectionPool::releaseConnection(std::shared_ptr<IDatabaseConnection> connection) {
+ConnectionPoolStats ConnectionPool::getStats() const {
     std::lock_guard<std::mutex> lock(poolMutex);
-    connections.push(connection);
-    condition.notify_one();
+    return ConnectionPoolStats{currentPoolSize, connections.size(), waitingThreads, averageWait};
 }
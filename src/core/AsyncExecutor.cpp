@@ -0,0 +1,147 @@
+#include "core/AsyncExecutor.h"
+#include <algorithm>
+
+namespace {
+// 작업자 스레드에서 대기열이 가득 찬 상태로 post() 하면 스스로를 막게 되므로 바로 실행합니다.
+thread_local bool isWorkerThread = false;
+}
+
+AsyncExecutor& AsyncExecutor::getInstance() {
+    static AsyncExecutor instance;
+    return instance;
+}
+
+AsyncExecutor::AsyncExecutor()
+    : queueCapacity(0), stopping(false), logger(Logger::getInstance()) {
+    size_t workerCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+    start(workerCount, workerCount * 16);
+}
+
+AsyncExecutor::~AsyncExecutor() {
+    stop();
+}
+
+void AsyncExecutor::configure(size_t workerCount, size_t newQueueCapacity) {
+    stop();
+    start(std::max<size_t>(workerCount, 1), std::max<size_t>(newQueueCapacity, 1));
+    logger.info("AsyncExecutor configured: " + std::to_string(workers.size()) + " workers, queue capacity " +
+                std::to_string(queueCapacity));
+}
+
+void AsyncExecutor::start(size_t workerCount, size_t newQueueCapacity) {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = false;
+    queueCapacity = newQueueCapacity;
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers.emplace_back(&AsyncExecutor::workerLoop, this);
+    }
+}
+
+void AsyncExecutor::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    notEmpty.notify_all();
+    notFull.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+}
+
+void AsyncExecutor::post(std::function<void()> task) {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (tasks.size() >= queueCapacity && isWorkerThread) {
+            lock.unlock();
+            task();
+            return;
+        }
+        notFull.wait(lock, [this]() { return tasks.size() < queueCapacity || stopping; });
+        tasks.push_back(std::move(task));
+    }
+    notEmpty.notify_one();
+}
+
+void AsyncExecutor::workerLoop() {
+    isWorkerThread = true;
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            notEmpty.wait(lock, [this]() { return stopping || !tasks.empty(); });
+            // 종료 중에도 남은 작업은 모두 실행합니다.
+            if (tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        notFull.notify_one();
+
+        try {
+            task();
+        } catch (const std::exception& e) {
+            logger.error(std::string("Unhandled exception in async task: ") + e.what());
+        }
+    }
+}
+
+size_t AsyncExecutor::getWorkerCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return workers.size();
+}
+
+size_t AsyncExecutor::getQueueCapacity() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return queueCapacity;
+}
+
+AsyncStrand::AsyncStrand(size_t capacity)
+    : capacity(std::max<size_t>(capacity, 1)), running(false) {}
+
+void AsyncStrand::post(std::function<void()> task) {
+    bool schedule = false;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [this]() { return pending.size() < capacity; });
+        pending.push_back(std::move(task));
+        if (!running) {
+            running = true;
+            schedule = true;
+        }
+    }
+    if (schedule) {
+        auto self = shared_from_this();
+        AsyncExecutor::getInstance().post([self]() { self->drain(); });
+    }
+}
+
+void AsyncStrand::drain() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (pending.empty()) {
+                running = false;
+                changed.notify_all();
+                return;
+            }
+            task = std::move(pending.front());
+            pending.pop_front();
+        }
+        changed.notify_all();
+
+        try {
+            task();
+        } catch (const std::exception& e) {
+            Logger::getInstance().error(std::string("Unhandled exception in async task: ") + e.what());
+        }
+    }
+}
+
+void AsyncStrand::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    changed.wait(lock, [this]() { return pending.empty() && !running; });
+}
@@ -0,0 +1,123 @@
+#include "core/GroupCommitWriter.h"
+#include "database/DatabaseConnectionFactory.h"
+#include <algorithm>
+#include "ORMException/DataAccessException/TransactionException/TransactionException.h"
+
+GroupCommitWriter::GroupCommitWriter(const DatabaseConfig& config, size_t maxBatchSize,
+                                     std::chrono::milliseconds maxDelay)
+    : connection(DatabaseConnectionFactory::createConnection(config)), maxBatchSize(std::max<size_t>(maxBatchSize, 1)), maxDelay(maxDelay),
+      logger(Logger::getInstance()), stopping(false) {
+    connection->connect();
+    writerThread = std::thread(&GroupCommitWriter::run, this);
+    logger.debug("GroupCommitWriter started.");
+}
+
+GroupCommitWriter::~GroupCommitWriter() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+    }
+    queueCondition.notify_all();
+    // 남은 작업은 쓰기 스레드가 모두 커밋한 뒤 종료합니다.
+    writerThread.join();
+    connection->disconnect();
+    logger.debug("GroupCommitWriter stopped.");
+}
+
+std::future<int> GroupCommitWriter::submit(Operation operation) {
+    PendingOperation pending{std::move(operation), std::promise<int>()};
+    auto future = pending.promise.get_future();
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (stopping) {
+            throw TransactionException("GroupCommitWriter is shutting down.");
+        }
+        queue.push_back(std::move(pending));
+        // 첫 작업이면 지연 타이머를, 배치가 가득 찼으면 즉시 커밋을 시작하도록 깨웁니다.
+        if (queue.size() != 1 && queue.size() < maxBatchSize) {
+            return future;
+        }
+    }
+    queueCondition.notify_one();
+    return future;
+}
+
+void GroupCommitWriter::run() {
+    std::vector<PendingOperation> batch;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueCondition.wait(lock, [this]() { return stopping || !queue.empty(); });
+            if (queue.empty()) {
+                return; // stopping
+            }
+
+            // 첫 작업 이후 maxDelay 동안 더 모읍니다.
+            auto deadline = std::chrono::steady_clock::now() + maxDelay;
+            queueCondition.wait_until(lock, deadline, [this]() { return stopping || queue.size() >= maxBatchSize; });
+
+            size_t count = std::min(queue.size(), maxBatchSize);
+            batch.assign(std::make_move_iterator(queue.begin()), std::make_move_iterator(queue.begin() + count));
+            queue.erase(queue.begin(), queue.begin() + count);
+        }
+
+        commitBatch(batch);
+        batch.clear();
+    }
+}
+
+void GroupCommitWriter::commitBatch(std::vector<PendingOperation>& batch) {
+    std::vector<int> results(batch.size(), 0);
+    std::vector<std::exception_ptr> errors(batch.size());
+
+    try {
+        connection->executeUpdate("BEGIN IMMEDIATE TRANSACTION");
+    } catch (...) {
+        auto error = std::current_exception();
+        for (auto& pending : batch) {
+            pending.promise.set_exception(error);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+        try {
+            connection->executeUpdate("SAVEPOINT group_commit_operation");
+            results[i] = batch[i].operation(*connection);
+            connection->executeUpdate("RELEASE group_commit_operation");
+        } catch (...) {
+            errors[i] = std::current_exception();
+            try {
+                // 실패한 작업의 변경만 되돌리고 배치는 계속합니다.
+                connection->executeUpdate("ROLLBACK TO group_commit_operation");
+                connection->executeUpdate("RELEASE group_commit_operation");
+            } catch (const std::exception& e) {
+                logger.error(std::string("Failed to roll back group commit operation: ") + e.what());
+            }
+        }
+    }
+
+    std::exception_ptr commitError;
+    try {
+        connection->commit();
+    } catch (...) {
+        commitError = std::current_exception();
+        try {
+            connection->rollback();
+        } catch (const std::exception& e) {
+            logger.error(std::string("Failed to roll back group commit batch: ") + e.what());
+        }
+    }
+
+    // 커밋이 끝난 뒤에 호출자를 깨웁니다.
+    for (size_t i = 0; i < batch.size(); ++i) {
+        if (errors[i]) {
+            batch[i].promise.set_exception(errors[i]);
+        } else if (commitError) {
+            batch[i].promise.set_exception(commitError);
+        } else {
+            batch[i].promise.set_value(results[i]);
+        }
+    }
+    logger.debug("Group commit: " + std::to_string(batch.size()) + " operations.");
+}
@@ -0,0 +1,50 @@
+#include "ReadSnapshot.h"
+#include "ORMException/DataAccessException/TransactionException/TransactionException.h"
+
+ReadSnapshot::ReadSnapshot(std::shared_ptr<IDatabaseConnection> connection, ConnectionReleaser releaser)
+    : connection(std::move(connection)), releaser(std::move(releaser)), logger(Logger::getInstance()) {
+    try {
+        this->connection->beginReadTransaction();
+    } catch (...) {
+        if (this->releaser) {
+            this->releaser(this->connection);
+        }
+        throw;
+    }
+
+    try {
+        handle = this->connection->captureSnapshot();
+    } catch (...) {
+        close();
+        throw;
+    }
+    if (!handle) {
+        close();
+        throw TransactionException("Snapshots are not supported by this database driver.");
+    }
+    logger.debug("Read snapshot captured.");
+}
+
+ReadSnapshot::~ReadSnapshot() {
+    handle.reset();
+    close();
+}
+
+const std::shared_ptr<void>& ReadSnapshot::getHandle() const {
+    return handle;
+}
+
+void ReadSnapshot::close() {
+    if (!connection) {
+        return;
+    }
+    try {
+        connection->commit();
+    } catch (const std::exception& e) {
+        logger.error("Failed to close snapshot read transaction: " + std::string(e.what()));
+    }
+    if (releaser) {
+        releaser(connection);
+    }
+    connection.reset();
+}
@@ -7,10 +7,20 @@
 #include "ORMException/InvalidParameterException/InvalidParameterException.h"
 #include "ORMException/MappingException/EntityNotFoundException/EntityNotFoundException.h"
 #include "ORMException/MappingException/MappingException.h"
+#include "ORMException/DataAccessException/LockAcquisitionException/LockAcqusitionException.h"
 #include "cache/CacheManager.h"
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <thread>
 
-Session::Session(std::shared_ptr<IDatabaseConnection> connection)
-    : connection(connection), logger(Logger::getInstance()), isTransactionActive(false) {
+Session::Session(std::shared_ptr<IDatabaseConnection> connection, ConnectionReleaser releaser)
+    : connection(connection), releaser(std::move(releaser)),
+      asyncStrand(std::make_shared<AsyncStrand>(AsyncExecutor::getInstance().getQueueCapacity())),
+      lifetime(std::make_shared<int>(0)), batchFetchSize(FetchContext::DEFAULT_BATCH_SIZE),
+      logger(Logger::getInstance()), isTransactionActive(false),
+      readOnlyTransaction(false), readUncommitted(false), flushMode(FlushMode::Immediate), flushing(false),
+      savepointSequence(0), cursorsClosed(false) {
     logger.debug("Session created.");
 }
 
@@ -32,25 +42,21 @@ void Session::save(std::shared_ptr<IEntity> entity) {
         throw MappingException("No mapping information found for entity: " + entity->getEntityName());
     }
 
-    // Build INSERT query with placeholders
-    std::string query = "INSERT INTO " + mappingInfo->tableName + " (";
-    std::string valuesPart = "VALUES (";
-
-    std::vector<std::any> params;
+    if (deferWrites()) {
+        enqueueWrite(PendingWrite::Kind::Insert, mappingInfo, entity);
+        return;
+    }
 
+    // 등록 시 생성된 INSERT 문 사용
+    std::vector<SQLParameter> params;
+    params.reserve(mappingInfo->fields.size());
     for (const auto& field : mappingInfo->fields) {
-        query += field.columnName + ", ";
-        valuesPart += "?, ";
-        params.push_back(entity->getFieldValue(field.fieldName));
+        params.push_back(field.readParameter(*entity));
     }
 
-    // Remove the last comma and space
-    query = query.substr(0, query.size() - 2) + ") ";
-    valuesPart = valuesPart.substr(0, valuesPart.size() - 2) + ");";
-    query += valuesPart;
-
     try {
-        connection->executeUpdate(query, params);
+        executeWrite(mappingInfo->sql.insert, params);
+        recordWrite(*mappingInfo, entity, false);
         logger.info("Entity saved successfully.");
     } catch (const QueryExecutionException& e) {
         logger.error(e.what());
@@ -70,27 +76,27 @@ void Session::update(std::shared_ptr<IEntity> entity) {
         throw MappingException("No mapping information found for entity: " + entity->getEntityName());
     }
 
-    // Build the UPDATE query with placeholders
-    std::string query = "UPDATE " + mappingInfo->tableName + " SET ";
-
-    std::vector<std::any> params;
-
-    for (const auto& field : mappingInfo->fields) {
-        query += field.columnName + " = ?, ";
-        params.push_back(entity->getFieldValue(field.fieldName));
+    if (mappingInfo->fields.empty()) {
+        logger.debug("Entity has no mapped fields to update: " + entity->getEntityName());
+        return;
     }
 
-    // Remove the last comma and space
-    if (!mappingInfo->fields.empty()) {
-        query = query.substr(0, query.size() - 2);
+    if (deferWrites()) {
+        enqueueWrite(PendingWrite::Kind::Update, mappingInfo, entity);
+        return;
     }
 
-    // WHERE clause
-    query += " WHERE " + mappingInfo->idColumnName + " = ?;";
-    params.push_back(entity->getId()); // Ensure that getId() returns an appropriate type
+    // 불러온 상태와 비교해 바뀐 컬럼만 씁니다. (마지막 파라미터가 ID)
+    std::string query;
+    std::vector<SQLParameter> params;
+    if (!prepareUpdate(*mappingInfo, *entity, query, params)) {
+        logger.debug("Entity has no changes to update: " + entity->getEntityName());
+        return;
+    }
 
     try {
-        connection->executeUpdate(query, params);
+        executeWrite(query, params);
+        recordWrite(*mappingInfo, entity, false);
         logger.info("Entity updated successfully.");
     } catch (const QueryExecutionException& e) {
         logger.error(e.what());
@@ -110,14 +116,17 @@ void Session::remove(std::shared_ptr<IEntity> entity) {
         throw MappingException("No mapping information found for entity: " + entity->getEntityName());
     }
 
-    // Build DELETE query with placeholder
-    std::string query = "DELETE FROM " + mappingInfo->tableName + " WHERE " + mappingInfo->idColumnName + " = ?;";
+    if (deferWrites()) {
+        enqueueWrite(PendingWrite::Kind::Delete, mappingInfo, entity);
+        return;
+    }
 
-    std::vector<std::any> params;
+    std::vector<SQLParameter> params;
     params.push_back(entity->getId());
 
     try {
-        connection->executeUpdate(query, params);
+        executeWrite(mappingInfo->sql.remove, params);
+        recordWrite(*mappingInfo, entity, true);
         logger.info("Entity removed successfully.");
     } catch (const QueryExecutionException& e) {
         logger.error(e.what());
@@ -125,19 +134,724 @@ void Session::remove(std::shared_ptr<IEntity> entity) {
     }
 }
 
+std::vector<Session::EntityGroup> Session::groupByMapping(const std::vector<std::shared_ptr<IEntity>>& entities) {
+    std::vector<EntityGroup> groups;
+    std::unordered_map<std::string, size_t> groupIndex;
+
+    for (const auto& entity : entities) {
+        if (!entity) {
+            throw InvalidParameterException("Entity cannot be null.");
+        }
+
+        const std::string entityName = entity->getEntityName();
+        auto it = groupIndex.find(entityName);
+        if (it == groupIndex.end()) {
+            auto mappingInfo = EntityMapper::getInstance().getMapping(entityName);
+            if (!mappingInfo) {
+                throw MappingException("No mapping information found for entity: " + entityName);
+            }
+            it = groupIndex.emplace(entityName, groups.size()).first;
+            groups.emplace_back(mappingInfo, std::vector<std::shared_ptr<IEntity>>());
+        }
+        groups[it->second].second.push_back(entity);
+    }
+
+    return groups;
+}
+
+void Session::setGroupCommitWriter(std::shared_ptr<GroupCommitWriter> writer) {
+    groupCommitWriter = std::move(writer);
+}
+
+void Session::setReadConnectionProvider(ConnectionProvider provider) {
+    readConnectionProvider = std::move(provider);
+}
+
+int Session::executeWrite(const std::string& query, const std::vector<SQLParameter>& params) {
+    if (readOnlyTransaction) {
+        throw TransactionException("Cannot write in a read-only transaction.");
+    }
+    if (!groupCommitWriter || isTransactionActive) {
+        return connection->executeUpdate(query, params);
+    }
+    // 결과를 기다리는 동안 query와 params는 유효하므로 참조로 넘깁니다.
+    return groupCommitWriter->submit([&query, &params](IDatabaseConnection& writer) {
+        return writer.executeUpdate(query, params);
+    }).get();
+}
+
+void Session::runInBatch(const std::function<void()>& work) {
+    if (readOnlyTransaction) {
+        throw TransactionException("Cannot write in a read-only transaction.");
+    }
+    if (isTransactionActive) {
+        // 배치가 중간에 실패해도 바깥 트랜잭션에 일부만 남지 않도록 세이브포인트로 감쌉니다.
+        auto nested = beginTransaction();
+        try {
+            work();
+            nested->commit();
+        } catch (...) {
+            try {
+                nested->rollback();
+            } catch (const std::exception& e) {
+                logger.error(e.what());
+            }
+            throw;
+        }
+        return;
+    }
+
+    // 쓰기 잠금을 미리 잡아 배치 도중 잠금 승격이 실패하지 않도록 합니다.
+    connection->executeUpdate("BEGIN IMMEDIATE TRANSACTION");
+    isTransactionActive = true;
+    try {
+        work();
+        connection->commit();
+    } catch (...) {
+        try {
+            connection->rollback();
+        } catch (const std::exception& e) {
+            logger.error(e.what());
+        }
+        isTransactionActive = false;
+        completeTransaction(false);
+        throw;
+    }
+    isTransactionActive = false;
+    completeTransaction(true);
+}
+
+std::string Session::cacheKey(const std::string& entityName, const std::string& id) {
+    return entityName + ":" + id;
+}
+
+void Session::recordWrite(const EntityMapping& mapping, const std::shared_ptr<IEntity>& entity, bool removed) {
+    std::string id = entity->getId();
+    if (id.empty()) {
+        // 아직 ID가 없는 엔티티는 어느 캐시에도 존재할 수 없습니다.
+        return;
+    }
+
+    std::string key = cacheKey(entity->getEntityName(), id);
+    if (removed) {
+        entityCache.erase(key);
+        entitySnapshots.erase(key);
+    } else {
+        entityCache[key] = entity;
+        // 방금 쓴 값이 데이터베이스의 상태이므로 다음 update의 비교 기준이 됩니다.
+        entitySnapshots[key] = captureFieldValues(mapping, entity);
+    }
+
+    if (isTransactionActive) {
+        if (!savepoints.empty()) {
+            savepoints.back().writtenKeys.insert(key);
+        }
+        pendingInvalidations.insert(std::move(key));
+    } else {
+        CacheManager::getInstance().remove(key);
+    }
+}
+
+void Session::completeTransaction(bool committed) {
+    auto& cacheManager = CacheManager::getInstance();
+    for (const auto& key : pendingInvalidations) {
+        if (committed) {
+            cacheManager.remove(key);
+        } else {
+            // 롤백된 변경이 반영된 1차 캐시 엔트리와 스냅샷은 폐기합니다.
+            entityCache.erase(key);
+            entitySnapshots.erase(key);
+        }
+    }
+    pendingInvalidations.clear();
+    savepoints.clear();
+    resetIsolationLevel();
+    if (!committed && !flushing && !pendingWrites.empty()) {
+        // 롤백하면 아직 flush되지 않은 변경도 함께 버립니다.
+        logger.debug("Discarding unflushed writes: " + std::to_string(pendingWrites.size()));
+        pendingWrites.clear();
+        pendingIndex.clear();
+    }
+}
+
+void Session::applyIsolationLevel(IsolationLevel isolationLevel) {
+    if (isolationLevel != IsolationLevel::READ_UNCOMMITTED) {
+        return;
+    }
+    try {
+        connection->executeUpdate("PRAGMA read_uncommitted = 1");
+        readUncommitted = true;
+    } catch (const QueryExecutionException& e) {
+        logger.error(e.what());
+        throw TransactionException("Failed to set isolation level: " + std::string(e.what()));
+    }
+}
+
+void Session::resetIsolationLevel() {
+    if (!readUncommitted) {
+        return;
+    }
+    readUncommitted = false;
+    try {
+        connection->executeUpdate("PRAGMA read_uncommitted = 0");
+    } catch (const QueryExecutionException& e) {
+        logger.warn("Failed to reset read_uncommitted: " + std::string(e.what()));
+    }
+}
+
+void Session::truncatePendingWrites(size_t size) {
+    pendingWrites.resize(size);
+    pendingIndex.clear();
+    for (size_t i = 0; i < pendingWrites.size(); ++i) {
+        if (!pendingWrites[i].cancelled) {
+            pendingIndex[pendingWrites[i].entity.get()] = i;
+        }
+    }
+}
+
+void Session::completeSavepoint(size_t depth, bool committed) {
+    if (depth == 0 || savepoints.size() < depth) {
+        return; // 바깥 세이브포인트나 트랜잭션과 함께 이미 끝남
+    }
+
+    // 세이브포인트를 끝내면 그 안쪽 세이브포인트도 함께 끝납니다.
+    std::unordered_set<std::string> keys;
+    for (size_t level = depth - 1; level < savepoints.size(); ++level) {
+        keys.insert(savepoints[level].writtenKeys.begin(), savepoints[level].writtenKeys.end());
+    }
+    size_t watermark = savepoints[depth - 1].pendingWatermark;
+    savepoints.resize(depth - 1);
+
+    if (committed) {
+        if (!savepoints.empty()) {
+            savepoints.back().writtenKeys.insert(keys.begin(), keys.end());
+        }
+        return;
+    }
+
+    // 세이브포인트 안에서 대기열에 넣은 작업은 실행하지 않고 버립니다. 그 엔티티도 1차 캐시에서 폐기합니다.
+    for (size_t i = watermark; i < pendingWrites.size(); ++i) {
+        const auto& entity = pendingWrites[i].entity;
+        std::string id = entity->getId();
+        if (!id.empty()) {
+            keys.insert(cacheKey(entity->getEntityName(), id));
+        }
+    }
+    if (watermark < pendingWrites.size()) {
+        logger.debug("Discarding unflushed writes of nested transaction: " +
+                     std::to_string(pendingWrites.size() - watermark));
+        truncatePendingWrites(watermark);
+    }
+    // 되돌린 변경이 반영된 1차 캐시 엔트리는 폐기합니다. 2차 캐시 무효화는 바깥 커밋 시 그대로 적용됩니다.
+    for (const auto& key : keys) {
+        entityCache.erase(key);
+        entitySnapshots.erase(key);
+    }
+}
+
+Session::EntitySnapshot Session::captureFieldValues(const EntityMapping& mapping,
+                                                   const std::shared_ptr<IEntity>& entity) {
+    EntitySnapshot snapshot;
+    snapshot.owner = entity;
+    std::vector<SQLParameter>& values = snapshot.values;
+    values.reserve(mapping.fields.size());
+    for (const auto& field : mapping.fields) {
+        // 접근자가 반환한 참조 값(string_view, BlobView)은 엔티티가 바뀌면 함께 바뀌므로 복사해 둡니다.
+        SQLParameter value = field.readParameter(*entity);
+        if (auto view = std::get_if<std::string_view>(&value)) {
+            values.emplace_back(std::string(*view));
+        } else if (auto blob = std::get_if<BlobView>(&value)) {
+            auto bytes = static_cast<const uint8_t*>(blob->data);
+            values.emplace_back(Blob(bytes, bytes + blob->size));
+        } else {
+            values.push_back(std::move(value));
+        }
+    }
+    return snapshot;
+}
+
+namespace {
+
+std::string_view bytesOf(const SQLParameter& value, bool& isBytes) {
+    isBytes = true;
+    if (auto text = std::get_if<std::string>(&value)) {
+        return *text;
+    } else if (auto view = std::get_if<std::string_view>(&value)) {
+        return *view;
+    } else if (auto blob = std::get_if<Blob>(&value)) {
+        return std::string_view(reinterpret_cast<const char*>(blob->data()), blob->size());
+    } else if (auto blobView = std::get_if<BlobView>(&value)) {
+        return std::string_view(static_cast<const char*>(blobView->data), blobView->size);
+    }
+    isBytes = false;
+    return std::string_view();
+}
+
+// 스냅샷 값과 현재 값이 같은지 비교합니다. 텍스트와 BLOB은 소유 여부와 관계없이 바이트로 비교합니다.
+bool sameValue(const SQLParameter& current, const SQLParameter& snapshot) {
+    bool currentIsBytes = false;
+    bool snapshotIsBytes = false;
+    std::string_view currentBytes = bytesOf(current, currentIsBytes);
+    std::string_view snapshotBytes = bytesOf(snapshot, snapshotIsBytes);
+    if (currentIsBytes || snapshotIsBytes) {
+        bool currentIsBlob = std::holds_alternative<Blob>(current) || std::holds_alternative<BlobView>(current);
+        bool snapshotIsBlob = std::holds_alternative<Blob>(snapshot) || std::holds_alternative<BlobView>(snapshot);
+        return currentIsBytes && snapshotIsBytes && currentIsBlob == snapshotIsBlob && currentBytes == snapshotBytes;
+    }
+    if (current.index() != snapshot.index()) {
+        return false;
+    }
+    if (auto integer = std::get_if<int64_t>(&current)) {
+        return *integer == std::get<int64_t>(snapshot);
+    } else if (auto real = std::get_if<double>(&current)) {
+        return *real == std::get<double>(snapshot);
+    }
+    return true; // 둘 다 NULL
+}
+
+// 변경된 컬럼 조합별 UPDATE 문. 같은 조합은 같은 SQL이므로 연결의 Statement 캐시에서도 재사용됩니다.
+// 키는 SQL을 결정하는 테이블·ID 컬럼·변경된 컬럼 이름으로 만듭니다. (매핑 주소는 재등록 후 해제되어 재사용될 수 있음)
+class PartialUpdateCache {
+public:
+    static constexpr size_t MAX_ENTRIES = 1024;
+
+    static std::string get(const EntityMapping& mapping, const std::vector<size_t>& changed) {
+        std::string key = mapping.tableName + ':' + mapping.idColumnName + ':';
+        for (size_t index : changed) {
+            key += mapping.fields[index].columnName;
+            key += ',';
+        }
+
+        static std::mutex mutex;
+        static std::unordered_map<std::string, std::string> statements;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = statements.find(key);
+            if (it != statements.end()) {
+                return it->second;
+            }
+        }
+
+        std::string sql = "UPDATE " + mapping.tableName + " SET ";
+        for (size_t i = 0; i < changed.size(); ++i) {
+            if (i > 0) {
+                sql += ", ";
+            }
+            sql += mapping.fields[changed[i]].columnName + " = ?";
+        }
+        sql += " WHERE " + mapping.idColumnName + " = ?;";
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (statements.size() < MAX_ENTRIES) {
+            statements.emplace(std::move(key), sql);
+        }
+        return sql;
+    }
+};
+
+} // namespace
+
+bool Session::prepareUpdate(const EntityMapping& mapping, const IEntity& entity, std::string& query,
+                            std::vector<SQLParameter>& params) {
+    params.clear();
+    params.reserve(mapping.fields.size() + 1);
+    for (const auto& field : mapping.fields) {
+        params.push_back(field.readParameter(entity));
+    }
+    std::string id = entity.getId();
+
+    // 같은 ID라도 다른 인스턴스는 스냅샷 이후의 상태를 알 수 없으므로 비교하지 않습니다.
+    auto snapshot = entitySnapshots.find(cacheKey(entity.getEntityName(), id));
+    if (snapshot == entitySnapshots.end() || snapshot->second.owner.lock().get() != &entity ||
+        snapshot->second.values.size() != params.size()) {
+        // 알려진 상태가 없으면 모든 컬럼을 씁니다.
+        query = mapping.sql.update;
+        params.push_back(std::move(id));
+        return true;
+    }
+
+    std::vector<size_t> changed;
+    for (size_t i = 0; i < params.size(); ++i) {
+        if (!sameValue(params[i], snapshot->second.values[i])) {
+            changed.push_back(i);
+        }
+    }
+    if (changed.empty()) {
+        return false;
+    }
+
+    if (changed.size() == params.size()) {
+        query = mapping.sql.update;
+    } else {
+        query = PartialUpdateCache::get(mapping, changed);
+        for (size_t i = 0; i < changed.size(); ++i) {
+            if (i != changed[i]) {
+                params[i] = std::move(params[changed[i]]);
+            }
+        }
+        params.resize(changed.size());
+    }
+    params.push_back(std::move(id));
+    return true;
+}
+
+void Session::setFlushMode(FlushMode mode) {
+    if (mode == FlushMode::Immediate) {
+        flush();
+    }
+    flushMode = mode;
+}
+
+FlushMode Session::getFlushMode() const {
+    return flushMode;
+}
+
+bool Session::deferWrites() const {
+    return flushMode == FlushMode::Commit && !flushing;
+}
+
+void Session::enqueueWrite(PendingWrite::Kind kind, const std::shared_ptr<const EntityMapping>& mapping,
+                           const std::shared_ptr<IEntity>& entity) {
+    if (readOnlyTransaction) {
+        throw TransactionException("Cannot write in a read-only transaction.");
+    }
+
+    auto it = pendingIndex.find(entity.get());
+    if (it == pendingIndex.end()) {
+        pendingIndex.emplace(entity.get(), pendingWrites.size());
+        pendingWrites.push_back(PendingWrite{kind, mapping, entity, false});
+        return;
+    }
+
+    // 같은 엔티티에 대한 작업을 하나로 합칩니다.
+    PendingWrite& pending = pendingWrites[it->second];
+    switch (pending.kind) {
+        case PendingWrite::Kind::Insert:
+            if (kind == PendingWrite::Kind::Delete) {
+                // 아직 저장되지 않은 엔티티이므로 INSERT와 DELETE 모두 필요 없습니다.
+                pending.cancelled = true;
+                pendingIndex.erase(it);
+            }
+            // INSERT 후 UPDATE는 flush 시점의 값으로 INSERT 하나만 실행합니다.
+            break;
+        case PendingWrite::Kind::Update:
+            if (kind == PendingWrite::Kind::Delete) {
+                pending.kind = PendingWrite::Kind::Delete;
+            } else if (kind == PendingWrite::Kind::Insert) {
+                throw InvalidParameterException("Entity is already persistent: " + entity->getEntityName());
+            }
+            break;
+        case PendingWrite::Kind::Delete:
+            if (kind == PendingWrite::Kind::Update) {
+                throw InvalidParameterException("Cannot update an entity scheduled for removal: " + entity->getEntityName());
+            } else if (kind == PendingWrite::Kind::Insert) {
+                // 삭제 후 다시 저장하면 같은 행을 모든 컬럼으로 덮어씁니다.
+                pending.kind = PendingWrite::Kind::Update;
+                entitySnapshots.erase(cacheKey(entity->getEntityName(), entity->getId()));
+            }
+            break;
+    }
+}
+
+std::vector<std::shared_ptr<const EntityMapping>> Session::orderByDependencies(
+    const std::vector<std::shared_ptr<const EntityMapping>>& mappings) {
+    // 외래 키를 가진 쪽(ManyToOne, joinColumn이 있는 OneToOne)이 대상 엔티티에 의존합니다.
+    std::unordered_map<std::string, size_t> indexByName;
+    for (size_t i = 0; i < mappings.size(); ++i) {
+        indexByName.emplace(mappings[i]->entityName, i);
+    }
+
+    std::vector<std::vector<size_t>> dependents(mappings.size());
+    std::vector<size_t> pendingDependencies(mappings.size(), 0);
+    for (size_t i = 0; i < mappings.size(); ++i) {
+        std::unordered_set<size_t> targets;
+        for (const auto& relationship : mappings[i]->relationships) {
+            bool ownsForeignKey = relationship.type == "ManyToOne" ||
+                                  (relationship.type == "OneToOne" && relationship.mappedBy.empty() &&
+                                   !relationship.joinColumn.empty());
+            auto target = indexByName.find(relationship.targetEntity);
+            if (ownsForeignKey && target != indexByName.end() && target->second != i &&
+                targets.insert(target->second).second) {
+                dependents[target->second].push_back(i);
+                ++pendingDependencies[i];
+            }
+        }
+    }
+
+    // 의존성이 없는 매핑부터 처음 등장한 순서대로 내보냅니다.
+    std::vector<std::shared_ptr<const EntityMapping>> ordered;
+    std::vector<bool> emitted(mappings.size(), false);
+    ordered.reserve(mappings.size());
+    while (ordered.size() < mappings.size()) {
+        bool progressed = false;
+        for (size_t i = 0; i < mappings.size(); ++i) {
+            if (emitted[i] || pendingDependencies[i] > 0) {
+                continue;
+            }
+            emitted[i] = true;
+            ordered.push_back(mappings[i]);
+            for (size_t dependent : dependents[i]) {
+                --pendingDependencies[dependent];
+            }
+            progressed = true;
+            break;
+        }
+        if (!progressed) {
+            // 순환 참조는 순서를 정할 수 없으므로 남은 매핑을 등장 순서대로 실행합니다.
+            logger.warn("Cyclic entity dependencies; flushing remaining entities in registration order.");
+            for (size_t i = 0; i < mappings.size(); ++i) {
+                if (!emitted[i]) {
+                    emitted[i] = true;
+                    ordered.push_back(mappings[i]);
+                }
+            }
+        }
+    }
+    return ordered;
+}
+
+void Session::flush() {
+    if (pendingWrites.empty()) {
+        return;
+    }
+
+    // 작업 종류와 매핑별로 묶습니다. (매핑은 처음 등장한 순서)
+    std::vector<std::shared_ptr<const EntityMapping>> mappings;
+    std::unordered_map<const EntityMapping*, std::array<std::vector<std::shared_ptr<IEntity>>, 3>> byMapping;
+    size_t operationCount = 0;
+    for (const auto& pending : pendingWrites) {
+        if (pending.cancelled) {
+            continue;
+        }
+        auto inserted = byMapping.emplace(pending.mapping.get(), std::array<std::vector<std::shared_ptr<IEntity>>, 3>());
+        if (inserted.second) {
+            mappings.push_back(pending.mapping);
+        }
+        inserted.first->second[static_cast<size_t>(pending.kind)].push_back(pending.entity);
+        ++operationCount;
+    }
+    auto ordered = orderByDependencies(mappings);
+
+    flushing = true;
+    try {
+        // INSERT는 참조되는 엔티티부터, DELETE는 참조하는 엔티티부터 실행합니다.
+        runInBatch([&]() {
+            for (const auto& mapping : ordered) {
+                auto& entities = byMapping[mapping.get()][static_cast<size_t>(PendingWrite::Kind::Insert)];
+                if (!entities.empty()) {
+                    insertGroup(EntityGroup(mapping, std::move(entities)));
+                }
+            }
+            for (const auto& mapping : ordered) {
+                auto& entities = byMapping[mapping.get()][static_cast<size_t>(PendingWrite::Kind::Update)];
+                if (!entities.empty()) {
+                    updateGroup(EntityGroup(mapping, std::move(entities)));
+                }
+            }
+            for (auto it = ordered.rbegin(); it != ordered.rend(); ++it) {
+                auto& entities = byMapping[it->get()][static_cast<size_t>(PendingWrite::Kind::Delete)];
+                if (!entities.empty()) {
+                    removeGroup(EntityGroup(*it, std::move(entities)));
+                }
+            }
+        });
+    } catch (...) {
+        // 실패한 flush는 되돌려졌으므로 대기 중인 작업을 유지해 다시 시도하거나 롤백할 수 있게 합니다.
+        flushing = false;
+        throw;
+    }
+    flushing = false;
+
+    pendingWrites.clear();
+    pendingIndex.clear();
+    logger.info("Session flushed. Operations: " + std::to_string(operationCount));
+}
+
+void Session::saveAll(const std::vector<std::shared_ptr<IEntity>>& entities) {
+    if (entities.empty()) {
+        return;
+    }
+    if (deferWrites()) {
+        for (const auto& entity : entities) {
+            save(entity);
+        }
+        return;
+    }
+
+    auto groups = groupByMapping(entities);
+    runInBatch([&]() {
+        for (const auto& group : groups) {
+            insertGroup(group);
+        }
+    });
+
+    logger.info("Entities saved successfully: " + std::to_string(entities.size()));
+}
+
+void Session::updateAll(const std::vector<std::shared_ptr<IEntity>>& entities) {
+    if (entities.empty()) {
+        return;
+    }
+    if (deferWrites()) {
+        for (const auto& entity : entities) {
+            update(entity);
+        }
+        return;
+    }
+
+    auto groups = groupByMapping(entities);
+    runInBatch([&]() {
+        for (const auto& group : groups) {
+            updateGroup(group);
+        }
+    });
+
+    logger.info("Entities updated successfully: " + std::to_string(entities.size()));
+}
+
+void Session::removeAll(const std::vector<std::shared_ptr<IEntity>>& entities) {
+    if (entities.empty()) {
+        return;
+    }
+    if (deferWrites()) {
+        for (const auto& entity : entities) {
+            remove(entity);
+        }
+        return;
+    }
+
+    auto groups = groupByMapping(entities);
+    runInBatch([&]() {
+        for (const auto& group : groups) {
+            removeGroup(group);
+        }
+    });
+
+    logger.info("Entities removed successfully: " + std::to_string(entities.size()));
+}
+
+void Session::insertGroup(const EntityGroup& group) {
+    int maxParameters = connection->getMaxParameterCount();
+    const auto& mappingInfo = group.first;
+    const auto& batch = group.second;
+    size_t columnCount = mappingInfo->fields.size();
+
+    if (columnCount == 0) {
+        for (const auto& entity : batch) {
+            connection->executeUpdate(mappingInfo->sql.insert);
+            recordWrite(*mappingInfo, entity, false);
+        }
+        return;
+    }
+
+    // 한 문장의 파라미터 수가 한도를 넘지 않도록 행 수를 정합니다.
+    size_t rowsPerChunk = std::max<size_t>(1, static_cast<size_t>(maxParameters) / columnCount);
+
+    const std::string& rowPlaceholder = mappingInfo->sql.rowPlaceholder;
+
+    // 같은 크기의 청크는 같은 SQL을 사용하므로 연결의 Statement 캐시에서 재사용됩니다.
+    std::string chunkQuery;
+    size_t chunkQueryRows = 0;
+
+    std::vector<SQLParameter> params;
+    for (size_t offset = 0; offset < batch.size(); offset += rowsPerChunk) {
+        size_t rows = std::min(rowsPerChunk, batch.size() - offset);
+        if (rows != chunkQueryRows) {
+            chunkQuery = "INSERT INTO " + mappingInfo->tableName + " (" + mappingInfo->sql.columnList + ") VALUES ";
+            chunkQuery.reserve(chunkQuery.size() + rows * (rowPlaceholder.size() + 2));
+            for (size_t row = 0; row < rows; ++row) {
+                if (row > 0) {
+                    chunkQuery += ", ";
+                }
+                chunkQuery += rowPlaceholder;
+            }
+            chunkQuery += ";";
+            chunkQueryRows = rows;
+        }
+
+        params.clear();
+        params.reserve(rows * columnCount);
+        for (size_t row = 0; row < rows; ++row) {
+            const auto& entity = batch[offset + row];
+            for (const auto& field : mappingInfo->fields) {
+                params.push_back(field.readParameter(*entity));
+            }
+        }
+
+        connection->executeUpdate(chunkQuery, params);
+    }
+
+    for (const auto& entity : batch) {
+        recordWrite(*mappingInfo, entity, false);
+    }
+}
+
+void Session::updateGroup(const EntityGroup& group) {
+    const auto& mappingInfo = group.first;
+
+    if (mappingInfo->fields.empty()) {
+        return;
+    }
+
+    // 바뀐 컬럼 조합이 같은 엔티티는 같은 Prepared Statement를 재사용합니다.
+    std::string query;
+    std::vector<SQLParameter> params;
+    for (const auto& entity : group.second) {
+        if (!prepareUpdate(*mappingInfo, *entity, query, params)) {
+            continue;
+        }
+        connection->executeUpdate(query, params);
+        recordWrite(*mappingInfo, entity, false);
+    }
+}
+
+void Session::removeGroup(const EntityGroup& group) {
+    size_t idsPerChunk = std::max<size_t>(1, static_cast<size_t>(connection->getMaxParameterCount()));
+    const auto& mappingInfo = group.first;
+    const auto& batch = group.second;
+
+    std::string chunkQuery;
+    size_t chunkQueryRows = 0;
+
+    std::vector<SQLParameter> params;
+    for (size_t offset = 0; offset < batch.size(); offset += idsPerChunk) {
+        size_t rows = std::min(idsPerChunk, batch.size() - offset);
+        if (rows != chunkQueryRows) {
+            chunkQuery = "DELETE FROM " + mappingInfo->tableName + " WHERE " + mappingInfo->idColumnName + " IN (";
+            for (size_t row = 0; row < rows; ++row) {
+                chunkQuery += row > 0 ? ", ?" : "?";
+            }
+            chunkQuery += ");";
+            chunkQueryRows = rows;
+        }
+
+        params.clear();
+        params.reserve(rows);
+        for (size_t row = 0; row < rows; ++row) {
+            params.push_back(batch[offset + row]->getId());
+        }
+
+        connection->executeUpdate(chunkQuery, params);
+    }
+
+    for (const auto& entity : batch) {
+        recordWrite(*mappingInfo, entity, true);
+    }
+}
+
 std::shared_ptr<IEntity> Session::find(const std::string& entityName, int id) {
     logger.debug("Finding entity: " + entityName + " with ID: " + std::to_string(id));
 
     // 1차 캐시 확인
-    std::string key = entityName + ":" + std::to_string(id);
+    std::string key = cacheKey(entityName, std::to_string(id));
     auto it = entityCache.find(key);
     if (it != entityCache.end()) {
         logger.debug("Entity found in cache: " + key);
         return it->second;
     }
 
-    // 2차 캐시 확인
-    auto cachedEntity = CacheManager::getInstance().get(key);
+    // 2차 캐시 확인. 읽기 전용(스냅샷) 트랜잭션은 고정된 시점의 데이터를 읽어야 하므로 2차 캐시를 사용하지 않습니다.
+    auto cachedEntity = readOnlyTransaction ? nullptr : CacheManager::getInstance().get(key);
     if (cachedEntity) {
         logger.debug("Entity found in second-level cache: " + key);
         entityCache[key] = cachedEntity;
@@ -149,26 +863,34 @@ std::shared_ptr<IEntity> Session::find(const std::string& entityName, int id) {
         throw MappingException("No mapping information found for entity: " + entityName);
     }
 
-    // SELECT 쿼리 생성
-    std::string query = "SELECT * FROM " + mappingInfo->tableName;
-    query += " WHERE " + mappingInfo->idColumnName + " = '" + std::to_string(id) + "';";
+    std::vector<SQLParameter> params;
+    params.push_back(static_cast<int64_t>(id));
 
     try {
-        auto results = connection->executeQuery(query);
+        // ID를 바인딩하여 모든 조회가 같은 Prepared Statement를 재사용
+        auto results = connection->executeQuery(mappingInfo->sql.selectById, params);
         if (results.empty()) {
             throw EntityNotFoundException("Entity not found: " + entityName + " with ID: " + std::to_string(id));
         }
 
         // 엔티티 생성 및 필드 설정
         auto entity = mappingInfo->entityConstructor();
-        entity->setId(std::to_string(id));
+        ColumnValue idValue;
+        idValue.type = ColumnType::Integer;
+        idValue.integer = id;
+        mappingInfo->assignId(*entity, idValue);
         for (const auto& field : mappingInfo->fields) {
-            entity->setFieldValue(field.fieldName, results[0][field.columnName]);
+            int column = results.findColumn(field.columnName);
+            field.assign(*entity, column >= 0 ? results.getValue(0, column) : ColumnValue());
         }
 
-        // 엔티티를 캐시에 저장.
+        // 엔티티를 캐시에 저장. 2차 캐시에는 autocommit 상태에서 읽은 값만 넣습니다.
+        // (트랜잭션 안에서 읽은 값은 커밋되지 않았거나 이전 스냅샷의 값일 수 있음)
         entityCache[key] = entity;
-        CacheManager::getInstance().put(key, entity);
+        entitySnapshots[key] = captureFieldValues(*mappingInfo, entity);
+        if (!isTransactionActive) {
+            CacheManager::getInstance().put(key, entity);
+        }
 
         logger.info("Entity found successfully.");
         return entity;
@@ -178,20 +900,144 @@ std::shared_ptr<IEntity> Session::find(const std::string& entityName, int id) {
     }
 }
 
+std::future<void> Session::saveAsync(std::shared_ptr<IEntity> entity) {
+    return asyncStrand->submit([this, entity]() { save(entity); });
+}
+
+std::future<void> Session::updateAsync(std::shared_ptr<IEntity> entity) {
+    return asyncStrand->submit([this, entity]() { update(entity); });
+}
+
+std::future<void> Session::removeAsync(std::shared_ptr<IEntity> entity) {
+    return asyncStrand->submit([this, entity]() { remove(entity); });
+}
+
+std::future<std::shared_ptr<IEntity>> Session::findAsync(const std::string& entityName, int id) {
+    return asyncStrand->submit([this, entityName, id]() { return find(entityName, id); });
+}
+
 std::shared_ptr<IQuery> Session::createQuery(const std::string& queryString) {
     logger.debug("Creating query: " + queryString);
-    return std::make_shared<Query>(connection, queryString);
+    auto query = std::make_shared<Query>(connection, queryString);
+    // listAsync()가 세션의 다른 비동기 작업과 같은 순서로 실행되도록 합니다.
+    query->setAsyncStrand(asyncStrand);
+    query->setFetchContext(fetchContext());
+    return query;
+}
+
+FetchContext Session::fetchContext() {
+    FetchContext context;
+    context.sessionLifetime = lifetime;
+    context.sessionBound = true;
+    context.batchSize = batchFetchSize;
+    // 세션이 닫히거나 소멸된 뒤 실행된 쿼리는 1차 캐시를 건드리지 않습니다.
+    std::weak_ptr<const void> token = lifetime;
+    context.identityMap = [this, token](const EntityMapping& mapping, const std::shared_ptr<IEntity>& entity) {
+        return token.expired() ? entity : registerLoaded(mapping, entity);
+    };
+    // 지연 로딩은 세션의 현재 연결을 씁니다. (읽기 전용 트랜잭션 중에는 빌린 읽기 연결)
+    context.sessionConnection = [this, token]() {
+        return token.expired() ? nullptr : connection;
+    };
+    context.trackCursor = [this, token](const std::shared_ptr<QueryCursor>& cursor) {
+        if (token.expired()) {
+            cursor->invalidate();
+        } else {
+            trackCursor(cursor);
+        }
+    };
+    return context;
+}
+
+void Session::trackCursor(const std::shared_ptr<QueryCursor>& cursor) {
+    {
+        std::lock_guard<std::mutex> lock(cursorMutex);
+        if (!cursorsClosed) {
+            // 다 쓰고 해제된 커서의 항목을 정리합니다.
+            openCursors.erase(std::remove_if(openCursors.begin(), openCursors.end(),
+                                             [](const std::weak_ptr<QueryCursor>& open) { return open.expired(); }),
+                              openCursors.end());
+            openCursors.push_back(cursor);
+            return;
+        }
+    }
+    cursor->invalidate();
+}
+
+void Session::invalidateCursors() {
+    std::vector<std::weak_ptr<QueryCursor>> cursors;
+    {
+        std::lock_guard<std::mutex> lock(cursorMutex);
+        cursorsClosed = true;
+        cursors.swap(openCursors);
+    }
+    for (auto& open : cursors) {
+        if (auto cursor = open.lock()) {
+            cursor->invalidate();
+        }
+    }
+}
+
+std::shared_ptr<IEntity> Session::registerLoaded(const EntityMapping& mapping, const std::shared_ptr<IEntity>& entity) {
+    std::string key = cacheKey(mapping.entityName, entity->getId());
+    auto it = entityCache.find(key);
+    if (it != entityCache.end()) {
+        return it->second;
+    }
+    entityCache.emplace(key, entity);
+    entitySnapshots[std::move(key)] = captureFieldValues(mapping, entity);
+    return entity;
+}
+
+void Session::setBatchFetchSize(size_t size) {
+    batchFetchSize = size > 0 ? size : 1;
 }
 
 std::shared_ptr<ITransaction> Session::beginTransaction(const TransactionDefinition& definition) {
     if (isTransactionActive) {
-        throw TransactionException("Transaction is already active.");
+        // 중첩 트랜잭션은 세이브포인트로 처리합니다. (트랜잭션 모드는 바깥 트랜잭션을 따름)
+        // 대기 중인 작업을 먼저 실행해, 세이브포인트 안에서 넣은 작업이 바깥 작업과 합쳐지지 않게 합니다.
+        if (!flushing) {
+            flush();
+        }
+        size_t depth = savepoints.size() + 1;
+        // 이름에 세션별 증가 번호를 붙여, 이미 끝난 중첩 트랜잭션 객체가 같은 깊이의 새 세이브포인트를 건드리지 않게 합니다.
+        std::string savepointName = "zenix_sp_" + std::to_string(depth) + "_" + std::to_string(++savepointSequence);
+        try {
+            connection->executeUpdate("SAVEPOINT " + savepointName);
+        } catch (const QueryExecutionException& e) {
+            logger.error(e.what());
+            throw TransactionException("Failed to begin nested transaction: " + std::string(e.what()));
+        }
+        savepoints.push_back(SavepointState{{}, pendingWrites.size()});
+        logger.debug("Nested transaction started: " + savepointName);
+
+        auto transaction = std::make_shared<Transaction>(
+            connection, isTransactionActive, [this, depth](bool committed) { completeSavepoint(depth, committed); },
+            savepointName);
+        // RELEASE 전에 세이브포인트 안에서 넣은 작업을 실행해 세이브포인트 범위에 포함시킵니다.
+        transaction->setBeforeCommit([this]() {
+            if (!flushing) {
+                flush();
+            }
+        });
+        return transaction;
+    }
+
+    if (definition.readOnly) {
+        return beginReadOnlyTransaction(definition);
     }
 
+    applyIsolationLevel(definition.isolationLevel);
     try {
         // 트랜잭션 모드에 따른 BEGIN 문 생성
         std::string beginTransactionSQL;
-        switch (definition.transactionMode) {
+        TransactionMode mode = definition.transactionMode;
+        if (definition.isolationLevel == IsolationLevel::SERIALIZABLE && mode == TransactionMode::DEFERRED) {
+            // 읽은 뒤 쓰기로 승격할 때 다른 쓰기에 밀려 SQLITE_BUSY_SNAPSHOT이 나지 않도록 처음부터 쓰기 잠금을 잡습니다.
+            mode = TransactionMode::IMMEDIATE;
+        }
+        switch (mode) {
             case TransactionMode::DEFERRED:
                 beginTransactionSQL = "BEGIN DEFERRED TRANSACTION";
                 break;
@@ -211,28 +1057,161 @@ std::shared_ptr<ITransaction> Session::beginTransaction(const TransactionDefinit
         isTransactionActive = true;
         logger.info("Transaction started with mode: " + beginTransactionSQL);
 
-        return std::make_shared<Transaction>(connection, isTransactionActive);
+        auto transaction = std::make_shared<Transaction>(connection, isTransactionActive,
+                                                         [this](bool committed) { completeTransaction(committed); });
+        // 커밋 직전에 대기 중인 작업을 실행합니다. (FlushMode::Commit)
+        transaction->setBeforeCommit([this]() {
+            if (!flushing) {
+                flush();
+            }
+        });
+        return transaction;
     } catch (const QueryExecutionException& e) {
         logger.error(e.what());
+        resetIsolationLevel();
         throw TransactionException("Failed to begin transaction: " + std::string(e.what()));
+    } catch (...) {
+        // 잠금 실패(LockAcquisitionException)는 재시도할 수 있도록 그대로 던지되 격리 수준은 되돌립니다.
+        resetIsolationLevel();
+        throw;
+    }
+}
+
+std::shared_ptr<ITransaction> Session::beginReadOnlyTransaction(const TransactionDefinition& definition) {
+    if (readConnectionProvider) {
+        // 트랜잭션 동안 세션의 조회도 빌린 연결에서 실행되도록 세션 연결과 바꿔 둡니다.
+        auto readConnection = readConnectionProvider(readConnectionReleaser);
+        sessionConnection = std::move(connection);
+        connection = std::move(readConnection);
+    }
+    try {
+        applyIsolationLevel(definition.isolationLevel);
+        // 읽기 트랜잭션은 쓰기 잠금 없이 DEFERRED로 시작하고, 스냅샷이 있으면 그 시점에 고정합니다.
+        connection->beginReadTransaction(definition.snapshot ? definition.snapshot->getHandle() : nullptr);
+    } catch (...) {
+        resetIsolationLevel();
+        restoreSessionConnection();
+        throw;
+    }
+    isTransactionActive = true;
+    readOnlyTransaction = true;
+    logger.info(definition.snapshot ? "Read-only transaction started on snapshot." : "Read-only transaction started.");
+
+    return std::make_shared<Transaction>(connection, isTransactionActive, [this](bool) {
+        readOnlyTransaction = false;
+        resetIsolationLevel();
+        restoreSessionConnection();
+    });
+}
+
+void Session::restoreSessionConnection() {
+    if (!sessionConnection) {
+        return;
+    }
+    auto readConnection = std::move(connection);
+    connection = std::move(sessionConnection);
+    sessionConnection.reset();
+    auto release = std::move(readConnectionReleaser);
+    readConnectionReleaser = nullptr;
+    if (release) {
+        release(std::move(readConnection));
+    }
+}
+
+void Session::inTransaction(const std::function<void(ISession&)>& work, const RetryPolicy& retryPolicy,
+                            const TransactionDefinition& definition) {
+    if (isTransactionActive) {
+        // 바깥 트랜잭션 안에서는 세이브포인트로 실행하여 실패 시 이 작업만 되돌립니다.
+        // 잠금 경합 재시도는 바깥 트랜잭션을 시작한 쪽이 결정합니다.
+        auto nested = beginTransaction(definition);
+        try {
+            work(*this);
+            nested->commit();
+        } catch (...) {
+            try {
+                nested->rollback();
+            } catch (const std::exception& e) {
+                logger.error(e.what());
+            }
+            throw;
+        }
+        return;
+    }
+
+    auto rollbackQuietly = [this](const std::shared_ptr<ITransaction>& transaction) {
+        if (transaction && isTransactionActive) {
+            try {
+                transaction->rollback();
+            } catch (const std::exception& e) {
+                logger.error(e.what());
+            }
+        }
+    };
+
+    for (size_t attempt = 1;; ++attempt) {
+        std::shared_ptr<ITransaction> transaction;
+        try {
+            transaction = beginTransaction(definition);
+            work(*this);
+            transaction->commit();
+            return;
+        } catch (const LockAcquisitionException& e) {
+            rollbackQuietly(transaction);
+            if (attempt >= retryPolicy.maxAttempts) {
+                logger.error("Transaction failed due to lock contention after " + std::to_string(attempt) + " attempts.");
+                throw LockAcquisitionException("Transaction failed after " + std::to_string(attempt) + " attempts: " +
+                                               e.what(), attempt - 1);
+            }
+            logger.warn("Lock contention in transaction. Retrying (attempt " + std::to_string(attempt + 1) + ").");
+            std::this_thread::sleep_for(retryPolicy.backoff(attempt));
+        } catch (...) {
+            rollbackQuietly(transaction);
+            throw;
+        }
     }
 }
 
 std::shared_ptr<IQueryBuilder> Session::createQueryBuilder() {
     logger.debug("Creating QueryBuilder.");
-    return std::make_shared<QueryBuilder>(connection);
+    auto builder = std::make_shared<QueryBuilder>(connection);
+    // 빌더가 만든 쿼리의 listAsync()도 세션의 다른 비동기 작업과 같은 순서로 실행되도록 합니다.
+    builder->setAsyncStrand(asyncStrand);
+    builder->setFetchContext(fetchContext());
+    return builder;
 }
 
 void Session::close() {
     if (connection) {
+        // 대기 중인 비동기 작업이 끝난 뒤에 연결을 반납합니다.
+        asyncStrand->waitIdle();
+        // 열린 커서의 문을 연결을 반납하기 전에 돌려받습니다. (트랜잭션 종료 전에 닫아야 ROLLBACK이 막히지 않음)
+        invalidateCursors();
         if (isTransactionActive) {
             try {
                 connection->rollback();
                 logger.warn("Transaction was active. Rolled back.");
-            } catch (const TransactionException& e) {
+            } catch (const std::exception& e) {
                 logger.error(e.what());
             }
             isTransactionActive = false;
+            readOnlyTransaction = false;
+            completeTransaction(false);
+            // 반납할 연결에 격리 수준 설정이 남지 않게 합니다.
+            resetIsolationLevel();
+            restoreSessionConnection();
+        }
+        if (!pendingWrites.empty()) {
+            logger.warn("Session closed with unflushed writes. Discarded: " + std::to_string(pendingWrites.size()));
+            pendingWrites.clear();
+            pendingIndex.clear();
+        }
+        // 이 세션의 쿼리 결과가 반납된 연결로 관계를 로드하지 못하게 합니다.
+        lifetime.reset();
+        // 1차 캐시의 엔티티는 세션 객체가 아니라 세션의 수명(close)과 함께 놓아 줍니다.
+        entityCache.clear();
+        entitySnapshots.clear();
+        if (releaser) {
+            releaser(std::move(connection));
         }
         connection.reset();
         logger.debug("Session closed.");
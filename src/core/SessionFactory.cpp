@@ -1,6 +1,41 @@
 #include "SessionFactory.h"
+#include "ORMException/ConfigurationException/ConfigurationException.h"
+#include "utils/logger/Logger.h"
+#include <algorithm>
+#include <thread>
 
-SessionFactory::SessionFactory() {}
+namespace {
+
+// 소유 스레드가 반납을 시도하고, 사용 중이면 마지막 사용자가 반납합니다. (반납은 한 번만)
+void returnLease(SessionFactory::ConnectionLease& lease) {
+    lease.owned = false;
+    if (!lease.inUse.exchange(true)) {
+        if (auto pool = lease.pool.lock()) {
+            pool->releaseConnection(lease.connection);
+        }
+    }
+}
+
+struct ThreadLeases {
+    std::shared_ptr<SessionFactory::ConnectionLease> write;
+    std::shared_ptr<SessionFactory::ConnectionLease> read;
+
+    ~ThreadLeases() {
+        if (write) {
+            returnLease(*write);
+        }
+        if (read) {
+            returnLease(*read);
+        }
+    }
+};
+
+thread_local ThreadLeases threadLeases;
+
+} // namespace
+
+SessionFactory::SessionFactory()
+    : threadAffinity(false), batchFetchSize(FetchContext::DEFAULT_BATCH_SIZE) {}
 
 SessionFactory::~SessionFactory() {}
 
@@ -10,17 +45,188 @@ SessionFactory& SessionFactory::getInstance() {
 }
 
 void SessionFactory::configure(const DatabaseConfig& config) {
-    // 초기 풀 크기와 최대 풀 크기를 설정합니다.
-    size_t initialPoolSize = 5;
-    size_t maxPoolSize = 20;
+    Logger& logger = Logger::getInstance();
+    // 쓰기 스레드가 남은 작업을 커밋한 뒤 이전 풀을 해제합니다.
+    groupCommitWriter.reset();
+    readerPool.reset();
+    threadAffinity = config.isThreadAffinityEnabled();
+    batchFetchSize = config.getBatchFetchSize();
+
+    std::string databaseName = config.getDatabaseName();
+    bool inMemory = databaseName.empty() || databaseName == ":memory:";
+    if (config.getPoolMode() != PoolMode::ReadWriteSplit || inMemory) {
+        if (config.getPoolMode() == PoolMode::ReadWriteSplit) {
+            // 메모리 DB는 연결마다 별개의 데이터베이스이므로 나눌 수 없습니다.
+            logger.warn("Read/write split requires a database file. Falling back to a shared pool.");
+        }
+
+        connectionPool = std::make_shared<ConnectionPool>(config, config.getMinPoolSize(), config.getMaxPoolSize());
+    } else {
+        configureReadWriteSplit(config);
+    }
+
+    // 비동기 작업자는 동시에 사용할 수 있는 연결 수만큼 둡니다.
+    size_t workers = readerPool ? readerPool->getStats().totalConnections + 1 : config.getMaxPoolSize();
+    AsyncExecutor::getInstance().configure(workers, workers * 16);
+
+    if (config.isGroupCommitEnabled()) {
+        DatabaseConfig writerConfig = config;
+        writerConfig.setReadOnly(false);
+        groupCommitWriter = std::make_shared<GroupCommitWriter>(writerConfig, config.getGroupCommitBatchSize(),
+                                                                config.getGroupCommitDelay());
+        logger.info("Group commit enabled: batch size " + std::to_string(config.getGroupCommitBatchSize()) + ", delay " +
+                    std::to_string(config.getGroupCommitDelay().count()) + " ms.");
+    }
+}
+
+void SessionFactory::configureReadWriteSplit(const DatabaseConfig& config) {
+    Logger& logger = Logger::getInstance();
+
+    // 쓰기 연결은 하나만 두어 SQLite의 쓰기 잠금 대신 풀에서 순서를 기다리게 합니다.
+    // 쓰기 연결이 먼저 열리며 데이터베이스 파일을 만들고 WAL 모드로 전환합니다.
+    DatabaseConfig writerConfig = config;
+    writerConfig.setReadOnly(false);
+    writerConfig.setWalMode(true);
+    connectionPool = std::make_shared<ConnectionPool>(writerConfig, 1, 1);
+
+    size_t readerCount = config.getReaderCount();
+    if (readerCount == 0) {
+        readerCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    DatabaseConfig readerConfig = config;
+    readerConfig.setReadOnly(true);
+    readerPool = std::make_shared<ConnectionPool>(readerConfig, readerCount, readerCount);
+
+    logger.info("Read/write split pool configured: 1 writer, " + std::to_string(readerCount) + " readers.");
+}
+
+const std::shared_ptr<ConnectionPool>& SessionFactory::readPool() const {
+    return readerPool ? readerPool : connectionPool;
+}
 
-    connectionPool = std::make_unique<ConnectionPool>(config, initialPoolSize, maxPoolSize);
+bool SessionFactory::usesLease(bool read) const {
+    // 쓰기 연결이 하나뿐인 분리 모드에서는 쓰기 연결을 한 스레드에 묶어두지 않습니다.
+    return threadAffinity && (read || !readerPool);
+}
+
+std::shared_ptr<IDatabaseConnection> SessionFactory::acquire(const std::shared_ptr<ConnectionPool>& pool, bool read,
+                                                             std::shared_ptr<ConnectionLease>& granted) {
+    granted.reset();
+    if (!usesLease(read)) {
+        return pool->acquireConnection();
+    }
+
+    auto& slot = read && readerPool ? threadLeases.read : threadLeases.write;
+    if (slot && slot->pool.lock() != pool) {
+        // 풀이 다시 구성되었으면 이전 임대를 해제합니다.
+        returnLease(*slot);
+        slot.reset();
+    }
+
+    // 빠른 경로: 같은 스레드의 다른 세션이 쓰고 있지 않으면 풀 잠금 없이 사용합니다.
+    if (slot && !slot->inUse.exchange(true)) {
+        if (slot->connection->isValid()) {
+            granted = slot;
+            return slot->connection;
+        }
+        // 더 이상 쓸 수 없는 연결은 풀에 돌려보내 폐기하고 새로 임대합니다.
+        slot->owned = false;
+        pool->releaseConnection(slot->connection);
+        slot.reset();
+    }
+
+    auto connection = pool->acquireConnection();
+    if (!slot) {
+        slot = std::make_shared<ConnectionLease>();
+        slot->connection = connection;
+        slot->pool = pool;
+        slot->inUse = true;
+        granted = slot;
+    }
+    return connection;
+}
+
+void SessionFactory::release(const std::shared_ptr<ConnectionPool>& pool, const std::shared_ptr<ConnectionLease>& granted,
+                             std::shared_ptr<IDatabaseConnection> connection) {
+    if (!granted) {
+        pool->releaseConnection(connection);
+        return;
+    }
+
+    granted->inUse = false;
+    // 소유 스레드가 이미 종료되었으면 여기서 풀로 반납합니다.
+    if (!granted->owned) {
+        returnLease(*granted);
+    }
+}
+
+std::shared_ptr<SessionFactory::ConnectionLease> SessionFactory::findLease(
+    const std::shared_ptr<IDatabaseConnection>& connection, bool read) const {
+    if (!usesLease(read)) {
+        return nullptr;
+    }
+    const auto& slot = read && readerPool ? threadLeases.read : threadLeases.write;
+    return slot && slot->connection == connection ? slot : nullptr;
+}
+
+std::shared_ptr<Session> SessionFactory::openSession(bool readOnly) {
+    if (!connectionPool) {
+        throw ConfigurationException("SessionFactory is not configured.");
+    }
+
+    auto pool = readOnly ? readPool() : connectionPool;
+    std::shared_ptr<ConnectionLease> lease;
+    auto connection = acquire(pool, readOnly, lease);
+    auto session = std::make_shared<Session>(connection, [pool, lease](std::shared_ptr<IDatabaseConnection> released) {
+        release(pool, lease, std::move(released));
+    });
+    if (!readOnly && groupCommitWriter) {
+        session->setGroupCommitWriter(groupCommitWriter);
+    }
+    if (!readOnly && readerPool) {
+        // 읽기 전용 트랜잭션은 하나뿐인 쓰기 연결 대신 읽기 연결에서 실행합니다.
+        auto readers = readerPool;
+        session->setReadConnectionProvider([this, readers](Session::ConnectionReleaser& releaser) {
+            std::shared_ptr<ConnectionLease> readLease;
+            auto readConnection = acquire(readers, true, readLease);
+            releaser = [readers, readLease](std::shared_ptr<IDatabaseConnection> released) {
+                release(readers, readLease, std::move(released));
+            };
+            return readConnection;
+        });
+    }
+    session->setBatchFetchSize(batchFetchSize);
+    return session;
+}
+
+std::shared_ptr<ReadSnapshot> SessionFactory::captureSnapshot() {
+    // 스냅샷은 다른 스레드에서 해제될 수 있으므로 세션처럼 임대 정보를 함께 넘깁니다.
+    auto pool = readPool();
+    std::shared_ptr<ConnectionLease> lease;
+    auto connection = acquire(pool, true, lease);
+    return std::make_shared<ReadSnapshot>(connection, [pool, lease](std::shared_ptr<IDatabaseConnection> released) {
+        release(pool, lease, std::move(released));
+    });
 }
 
 std::shared_ptr<IDatabaseConnection> SessionFactory::getConnection() {
-    return connectionPool->acquireConnection();
+    std::shared_ptr<ConnectionLease> lease;
+    return acquire(connectionPool, false, lease);
 }
 
 void SessionFactory::releaseConnection(std::shared_ptr<IDatabaseConnection> connection) {
-    connectionPool->releaseConnection(connection);
+    // 임대 연결은 빌린 스레드에서 반납해야 합니다.
+    // 인자 평가 순서가 정해져 있지 않으므로 연결을 넘기기 전에 임대를 먼저 찾습니다.
+    auto lease = findLease(connection, false);
+    release(connectionPool, lease, std::move(connection));
+}
+
+std::shared_ptr<IDatabaseConnection> SessionFactory::getReadConnection() {
+    std::shared_ptr<ConnectionLease> lease;
+    return acquire(readPool(), true, lease);
+}
+
+void SessionFactory::releaseReadConnection(std::shared_ptr<IDatabaseConnection> connection) {
+    auto lease = findLease(connection, true);
+    release(readPool(), lease, std::move(connection));
 }
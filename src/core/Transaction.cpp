@@ -1,8 +1,12 @@
 #include "core/Transaction.h"
 #include "ORMException/DataAccessException/TransactionException/TransactionException.h"
+#include "ORMException/DataAccessException/QueryExecutionException/QueryExecutionException.h"
+#include "ORMException/DataAccessException/DataAccessException.h"
 
-Transaction::Transaction(std::shared_ptr<IDatabaseConnection> connection, bool& transactionFlag)
-    : connection(connection), logger(Logger::getInstance()), isTransactionActive(transactionFlag), isCommittedOrRolledBack(false) {
+Transaction::Transaction(std::shared_ptr<IDatabaseConnection> connection, bool& transactionFlag,
+                         std::function<void(bool)> completionCallback, const std::string& savepointName)
+    : connection(connection), logger(Logger::getInstance()), isTransactionActive(transactionFlag), isCommittedOrRolledBack(false),
+      completionCallback(std::move(completionCallback)), savepointName(savepointName) {
         logger.debug("Transaction created.");
 }
 
@@ -11,8 +15,11 @@ Transaction::~Transaction() {
         try {
             rollback();
             logger.warn("Transaction was not committed. Rolled back.");
-        } catch (const TransactionException& e) {
+        } catch (const std::exception& e) {
+            // 소멸자에서는 잠금 실패(LockAcquisitionException) 등 어떤 예외도 밖으로 내보내지 않습니다.
             logger.error(e.what());
+        } catch (...) {
+            logger.error("Unknown error while rolling back an unfinished transaction.");
         }
     }
 
@@ -24,12 +31,24 @@ void Transaction::commit() {
         throw TransactionException("No active transaction to commit.");
     }
 
+    if (beforeCommit) {
+        beforeCommit();
+    }
+
+    if (!savepointName.empty()) {
+        completeSavepoint(true);
+        return;
+    }
+
     try {
         connection->commit();
         isTransactionActive = false;
         isCommittedOrRolledBack = true;
         logger.info("Transaction committed.");
-    } catch (const TransactionException& e) {
+        if (completionCallback) {
+            completionCallback(true);
+        }
+    } catch (const DataAccessException& e) {
         logger.error(e.what());
         throw;
     }
@@ -40,13 +59,52 @@ void Transaction::rollback() {
         throw TransactionException("No active transaction to rollback.");
     }
 
+    if (!savepointName.empty()) {
+        completeSavepoint(false);
+        return;
+    }
+
     try {
         connection->rollback();
         isTransactionActive = false;
         isCommittedOrRolledBack = true;
         logger.info("Transaction rolled back.");
-    } catch (const TransactionException& e) {
+        if (completionCallback) {
+            completionCallback(false);
+        }
+    } catch (const DataAccessException& e) {
         logger.error(e.what());
         throw;
     }
-}
\ No newline at end of file
+}
+
+void Transaction::completeSavepoint(bool commit) {
+    if (isCommittedOrRolledBack) {
+        throw TransactionException("Nested transaction already completed: " + savepointName);
+    }
+
+    try {
+        if (commit) {
+            connection->executeUpdate("RELEASE SAVEPOINT " + savepointName);
+        } else {
+            // ROLLBACK TO는 세이브포인트를 남겨두므로 RELEASE로 함께 제거합니다.
+            connection->executeUpdate("ROLLBACK TO SAVEPOINT " + savepointName);
+            connection->executeUpdate("RELEASE SAVEPOINT " + savepointName);
+        }
+    } catch (const DataAccessException& e) {
+        // 실행 오류뿐 아니라 잠금 실패(LockAcquisitionException)도 세이브포인트 오류로 알립니다.
+        logger.error(e.what());
+        throw TransactionException("Failed to " + std::string(commit ? "release" : "roll back to") + " savepoint " +
+                                   savepointName + ": " + e.what());
+    }
+
+    isCommittedOrRolledBack = true;
+    logger.debug(std::string("Nested transaction ") + (commit ? "released: " : "rolled back: ") + savepointName);
+    if (completionCallback) {
+        completionCallback(commit);
+    }
+}
+
+void Transaction::setBeforeCommit(std::function<void()> callback) {
+    beforeCommit = std::move(callback);
+}
@@ -1,7 +1,11 @@
 #include "include/database/DatabaseConfig.h"
 
 DatabaseConfig::DatabaseConfig()
-    : dbType(DatabaseType::SQLite), dbName("default.db") {
+    : dbType(DatabaseType::SQLite), dbName("default.db"), poolMode(PoolMode::Shared),
+      readerCount(0), readOnly(false), minPoolSize(5), maxPoolSize(20),
+      connectionTimeout(std::chrono::seconds(10)), idleTimeout(std::chrono::seconds(60)),
+      threadAffinity(false), groupCommit(false), groupCommitBatchSize(128), groupCommitDelay(2),
+      batchFetchSize(100) {
 }
 
 void DatabaseConfig::setDatabaseType(DatabaseType type) {
@@ -12,6 +16,65 @@ void DatabaseConfig::setDatabaseName(const std::string& name) {
     dbName = name;
 }
 
+void DatabaseConfig::setPoolMode(PoolMode mode) {
+    poolMode = mode;
+}
+
+void DatabaseConfig::setReaderCount(size_t count) {
+    readerCount = count;
+}
+
+void DatabaseConfig::setReadOnly(bool value) {
+    readOnly = value;
+}
+
+void DatabaseConfig::setWalMode(bool value) {
+    if (value) {
+        tuning.journalMode = JournalMode::WAL;
+    } else if (tuning.journalMode == JournalMode::WAL) {
+        // 직접 지정한 다른 저널 모드(TRUNCATE 등)는 유지합니다.
+        tuning.journalMode = JournalMode::Default;
+    }
+}
+
+void DatabaseConfig::setTuningProfile(const TuningProfile& profile) {
+    tuning = profile;
+}
+
+void DatabaseConfig::setRetryPolicy(const RetryPolicy& policy) {
+    retryPolicy = policy;
+}
+
+void DatabaseConfig::setMinPoolSize(size_t size) {
+    minPoolSize = size;
+}
+
+void DatabaseConfig::setMaxPoolSize(size_t size) {
+    maxPoolSize = size;
+}
+
+void DatabaseConfig::setConnectionTimeout(std::chrono::milliseconds timeout) {
+    connectionTimeout = timeout;
+}
+
+void DatabaseConfig::setIdleTimeout(std::chrono::milliseconds timeout) {
+    idleTimeout = timeout;
+}
+
+void DatabaseConfig::setThreadAffinity(bool enabled) {
+    threadAffinity = enabled;
+}
+
+void DatabaseConfig::setGroupCommit(bool enabled, size_t maxBatchSize, std::chrono::milliseconds maxDelay) {
+    groupCommit = enabled;
+    groupCommitBatchSize = maxBatchSize;
+    groupCommitDelay = maxDelay;
+}
+
+void DatabaseConfig::setBatchFetchSize(size_t size) {
+    batchFetchSize = size > 0 ? size : 1;
+}
+
 DatabaseType DatabaseConfig::getDatabaseType() const {
     return dbType;
 }
@@ -19,3 +82,63 @@ DatabaseType DatabaseConfig::getDatabaseType() const {
 std::string DatabaseConfig::getDatabaseName() const {
     return dbName;
 }
+
+PoolMode DatabaseConfig::getPoolMode() const {
+    return poolMode;
+}
+
+size_t DatabaseConfig::getReaderCount() const {
+    return readerCount;
+}
+
+bool DatabaseConfig::isReadOnly() const {
+    return readOnly;
+}
+
+bool DatabaseConfig::isWalMode() const {
+    return tuning.journalMode == JournalMode::WAL;
+}
+
+const TuningProfile& DatabaseConfig::getTuningProfile() const {
+    return tuning;
+}
+
+const RetryPolicy& DatabaseConfig::getRetryPolicy() const {
+    return retryPolicy;
+}
+
+size_t DatabaseConfig::getMinPoolSize() const {
+    return minPoolSize;
+}
+
+size_t DatabaseConfig::getMaxPoolSize() const {
+    return maxPoolSize;
+}
+
+std::chrono::milliseconds DatabaseConfig::getConnectionTimeout() const {
+    return connectionTimeout;
+}
+
+std::chrono::milliseconds DatabaseConfig::getIdleTimeout() const {
+    return idleTimeout;
+}
+
+bool DatabaseConfig::isThreadAffinityEnabled() const {
+    return threadAffinity;
+}
+
+bool DatabaseConfig::isGroupCommitEnabled() const {
+    return groupCommit;
+}
+
+size_t DatabaseConfig::getGroupCommitBatchSize() const {
+    return groupCommitBatchSize;
+}
+
+std::chrono::milliseconds DatabaseConfig::getGroupCommitDelay() const {
+    return groupCommitDelay;
+}
+
+size_t DatabaseConfig::getBatchFetchSize() const {
+    return batchFetchSize;
+}
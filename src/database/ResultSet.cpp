@@ -0,0 +1,214 @@
+#include "include/database/ResultSet.h"
+#include "include/utils/ORMException/InvalidParameterException/InvalidParameterException.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+ResultSet::ResultSet()
+    : header(std::make_shared<Header>()) {}
+
+ResultSet::ResultSet(std::vector<std::string> columnNames) {
+    auto newHeader = std::make_shared<Header>();
+    newHeader->names = std::move(columnNames);
+    for (size_t i = 0; i < newHeader->names.size(); ++i) {
+        // 중복된 컬럼 이름은 첫 번째 컬럼을 가리킵니다.
+        newHeader->index.emplace(newHeader->names[i], i);
+    }
+    header = std::move(newHeader);
+}
+
+size_t ResultSet::rowCount() const {
+    size_t columns = columnCount();
+    return columns == 0 ? 0 : cells.size() / columns;
+}
+
+size_t ResultSet::columnCount() const {
+    return header->names.size();
+}
+
+bool ResultSet::empty() const {
+    return rowCount() == 0;
+}
+
+const std::vector<std::string>& ResultSet::getColumnNames() const {
+    return header->names;
+}
+
+const std::string& ResultSet::getColumnName(size_t column) const {
+    if (column >= columnCount()) {
+        throw InvalidParameterException("Column index out of range: " + std::to_string(column));
+    }
+    return header->names[column];
+}
+
+int ResultSet::findColumn(const std::string& name) const {
+    auto it = header->index.find(name);
+    return it != header->index.end() ? static_cast<int>(it->second) : -1;
+}
+
+const ResultSet::Cell& ResultSet::cellAt(size_t row, size_t column) const {
+    size_t columns = columnCount();
+    if (column >= columns || row >= rowCount()) {
+        throw InvalidParameterException("Cell index out of range: (" + std::to_string(row) + ", " + std::to_string(column) + ")");
+    }
+    return cells[row * columns + column];
+}
+
+ColumnType ResultSet::getType(size_t row, size_t column) const {
+    return cellAt(row, column).type;
+}
+
+bool ResultSet::isNull(size_t row, size_t column) const {
+    return cellAt(row, column).type == ColumnType::Null;
+}
+
+int64_t ResultSet::getInt64(size_t row, size_t column) const {
+    const Cell& cell = cellAt(row, column);
+    switch (cell.type) {
+        case ColumnType::Integer:
+            return cell.integer;
+        case ColumnType::Real:
+            return static_cast<int64_t>(cell.real);
+        case ColumnType::Text:
+            return std::strtoll(std::string(getText(row, column)).c_str(), nullptr, 10);
+        default:
+            return 0;
+    }
+}
+
+double ResultSet::getDouble(size_t row, size_t column) const {
+    const Cell& cell = cellAt(row, column);
+    switch (cell.type) {
+        case ColumnType::Integer:
+            return static_cast<double>(cell.integer);
+        case ColumnType::Real:
+            return cell.real;
+        case ColumnType::Text:
+            return std::strtod(std::string(getText(row, column)).c_str(), nullptr);
+        default:
+            return 0.0;
+    }
+}
+
+std::string_view ResultSet::getText(size_t row, size_t column) const {
+    const Cell& cell = cellAt(row, column);
+    if (cell.type != ColumnType::Text && cell.type != ColumnType::Blob) {
+        return std::string_view();
+    }
+    return std::string_view(data.data() + cell.offset, cell.length);
+}
+
+std::string ColumnValue::toString() const {
+    switch (type) {
+        case ColumnType::Integer:
+            return std::to_string(integer);
+        case ColumnType::Real: {
+            // SQLite의 텍스트 변환처럼 값을 그대로 되돌릴 수 있는 가장 짧은 표현을 쓰고,
+            // 정수 값에는 ".0"을 붙여 INTEGER와 구분합니다. (예: 0.1 -> "0.1", 3 -> "3.0", 1e20 -> "1.0e+20")
+            if (std::isinf(real)) {
+                return real > 0 ? "Inf" : "-Inf";
+            }
+            char buffer[32];
+            for (int precision = 15; precision <= 17; ++precision) {
+                std::snprintf(buffer, sizeof(buffer), "%.*g", precision, real);
+                if (std::strtod(buffer, nullptr) == real) {
+                    break;
+                }
+            }
+            std::string formatted = buffer;
+            if (formatted.find_first_of(".n") == std::string::npos) {
+                size_t exponent = formatted.find('e');
+                formatted.insert(exponent == std::string::npos ? formatted.size() : exponent, ".0");
+            }
+            return formatted;
+        }
+        case ColumnType::Text:
+        case ColumnType::Blob:
+            return std::string(text);
+        default:
+            return "";
+    }
+}
+
+std::string ResultSet::getString(size_t row, size_t column) const {
+    return getValue(row, column).toString();
+}
+
+std::string ResultSet::getString(size_t row, const std::string& columnName) const {
+    int column = findColumn(columnName);
+    if (column < 0) {
+        throw InvalidParameterException("Unknown column: " + columnName);
+    }
+    return getString(row, static_cast<size_t>(column));
+}
+
+ColumnValue ResultSet::getValue(size_t row, size_t column) const {
+    const Cell& cell = cellAt(row, column);
+    ColumnValue value;
+    value.type = cell.type;
+    switch (cell.type) {
+        case ColumnType::Integer:
+            value.integer = cell.integer;
+            break;
+        case ColumnType::Real:
+            value.real = cell.real;
+            break;
+        case ColumnType::Text:
+        case ColumnType::Blob:
+            value.text = std::string_view(data.data() + cell.offset, cell.length);
+            break;
+        default:
+            break;
+    }
+    return value;
+}
+
+void ResultSet::reserve(size_t rows, size_t dataBytes) {
+    cells.reserve(rows * columnCount());
+    if (dataBytes > 0) {
+        data.reserve(dataBytes);
+    }
+}
+
+void ResultSet::appendNull() {
+    Cell cell;
+    cell.type = ColumnType::Null;
+    cell.length = 0;
+    cell.integer = 0;
+    cells.push_back(cell);
+}
+
+void ResultSet::appendInt64(int64_t value) {
+    Cell cell;
+    cell.type = ColumnType::Integer;
+    cell.length = 0;
+    cell.integer = value;
+    cells.push_back(cell);
+}
+
+void ResultSet::appendDouble(double value) {
+    Cell cell;
+    cell.type = ColumnType::Real;
+    cell.length = 0;
+    cell.real = value;
+    cells.push_back(cell);
+}
+
+void ResultSet::appendText(const char* text, size_t length) {
+    appendBytes(ColumnType::Text, text, length);
+}
+
+void ResultSet::appendBlob(const void* blob, size_t length) {
+    appendBytes(ColumnType::Blob, blob, length);
+}
+
+void ResultSet::appendBytes(ColumnType type, const void* bytes, size_t length) {
+    Cell cell;
+    cell.type = type;
+    cell.length = static_cast<uint32_t>(length);
+    cell.offset = data.size();
+    if (length > 0) {
+        data.insert(data.end(), static_cast<const char*>(bytes), static_cast<const char*>(bytes) + length);
+    }
+    cells.push_back(cell);
+}
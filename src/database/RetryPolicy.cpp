@@ -0,0 +1,24 @@
+#include "include/database/RetryPolicy.h"
+#include <algorithm>
+#include <random>
+
+std::chrono::microseconds RetryPolicy::backoff(size_t retry) const {
+    double delay = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(initialBackoff).count());
+    double limit = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(maxBackoff).count());
+    for (size_t i = 1; i < retry && delay < limit; ++i) {
+        delay *= multiplier;
+    }
+    delay = std::min(delay, limit);
+
+    // 스레드마다 독립된 난수 생성기를 사용합니다.
+    thread_local std::mt19937 generator(std::random_device{}());
+    double spread = std::clamp(jitter, 0.0, 1.0);
+    std::uniform_real_distribution<double> distribution(1.0 - spread, 1.0);
+    return std::chrono::microseconds(static_cast<long long>(delay * distribution(generator)));
+}
+
+RetryPolicy RetryPolicy::none() {
+    RetryPolicy policy;
+    policy.maxAttempts = 1;
+    return policy;
+}
@@ -0,0 +1,44 @@
+#include "include/database/SQLParameter.h"
+#include "include/utils/ORMException/InvalidParameterException/InvalidParameterException.h"
+
+SQLParameter toSQLParameter(const std::any& value) {
+    if (!value.has_value()) {
+        return nullptr;
+    }
+
+    const std::type_info& type = value.type();
+    if (type == typeid(std::string)) {
+        return std::any_cast<const std::string&>(value);
+    } else if (type == typeid(int)) {
+        return static_cast<int64_t>(std::any_cast<int>(value));
+    } else if (type == typeid(int64_t)) {
+        return std::any_cast<int64_t>(value);
+    } else if (type == typeid(long long)) {
+        return static_cast<int64_t>(std::any_cast<long long>(value));
+    } else if (type == typeid(long)) {
+        return static_cast<int64_t>(std::any_cast<long>(value));
+    } else if (type == typeid(unsigned int)) {
+        return static_cast<int64_t>(std::any_cast<unsigned int>(value));
+    } else if (type == typeid(bool)) {
+        return static_cast<int64_t>(std::any_cast<bool>(value) ? 1 : 0);
+    } else if (type == typeid(double)) {
+        return std::any_cast<double>(value);
+    } else if (type == typeid(float)) {
+        return static_cast<double>(std::any_cast<float>(value));
+    } else if (type == typeid(const char*)) {
+        const char* text = std::any_cast<const char*>(value);
+        return text ? SQLParameter(std::string(text)) : SQLParameter(nullptr);
+    } else if (type == typeid(std::string_view)) {
+        return std::any_cast<std::string_view>(value);
+    } else if (type == typeid(Blob)) {
+        return std::any_cast<const Blob&>(value);
+    } else if (type == typeid(BlobView)) {
+        return std::any_cast<BlobView>(value);
+    } else if (type == typeid(std::nullptr_t)) {
+        return nullptr;
+    } else if (type == typeid(SQLParameter)) {
+        return std::any_cast<const SQLParameter&>(value);
+    }
+
+    throw InvalidParameterException(std::string("Unsupported parameter type: ") + type.name());
+}
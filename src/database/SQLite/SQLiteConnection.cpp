@@ -2,208 +2,653 @@
 #include "../DatabaseConnectionException/DatabaseConnectionException.h"
 #include "../QueryExecutionException/QueryExecutionException.h"
 #include "../TransactionException/TransactionException.h"
+#include "../LockAcquisitionException/LockAcqusitionException.h"
 #include "database/DatabaseConfig.h"
+#include "cache/TableVersionRegistry.h"
 #include <regex>
+#include <algorithm>
+#include <thread>
+
+const std::string SQLiteConnection::READ_TABLES_KEY = "SQLiteConnection.readTables";
+const std::string SQLiteConnection::WRITE_TABLES_KEY = "SQLiteConnection.writeTables";
 
 SQLiteConnection::SQLiteConnection(const DatabaseConfig& config)
     : db(nullptr), config(config), logger(Logger::getInstance()),
-      isConnected(false), isInTransaction(false) {}
+      isConnected(false), retries(0), readTableCollector(nullptr),
+      writeTableCollector(nullptr) {}
 
 SQLiteConnection::~SQLiteConnection() {
     disconnect();
 }
 
+std::unique_lock<std::mutex> SQLiteConnection::lockConnection() {
+    // 스레드 고정으로 임대한 연결도 세션의 비동기 작업, 지연 로딩, 커서에서 다른 스레드가 사용할 수 있으므로
+    // 항상 잠급니다. (경합이 없으면 비용이 거의 없음)
+    return std::unique_lock<std::mutex>(connectionMutex);
+}
+
 void SQLiteConnection::connect() {
-    std::lock_guard<std::mutex> lock(connectionMutex);
+    auto lock = lockConnection();
     if (isConnected) {
         logger.warn("Already connected to the database.");
         return;
     }
-    int rc = sqlite3_open(config.getDatabaseName().c_str(), &db);
+    const TuningProfile& tuning = config.getTuningProfile();
+    int flags = config.isReadOnly() ? SQLITE_OPEN_READONLY : (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
+    if (tuning.noMutex) {
+        // 명시적으로 요청한 경우에만 SQLite 내부의 연결 단위 뮤텍스를 끕니다.
+        flags |= SQLITE_OPEN_NOMUTEX;
+    }
+    if (tuning.sharedCache) {
+        flags |= SQLITE_OPEN_SHAREDCACHE;
+    }
+    int rc = sqlite3_open_v2(config.getDatabaseName().c_str(), &db, flags, nullptr);
     if (rc != SQLITE_OK) {
-        std::string errorMessage = sqlite3_errmsg(db);
+        std::string errorMessage = db ? sqlite3_errmsg(db) : sqlite3_errstr(rc);
         logger.error("Failed to connect to SQLite database: " + errorMessage);
+        sqlite3_close_v2(db);
+        db = nullptr;
         throw DatabaseConnectionException(errorMessage);
     }
+    applyTuning(tuning);
     isConnected = true;
-    logger.info("Connected to SQLite database: " + config.getDatabaseName());
+    installHooks();
+    logger.info(std::string("Connected to SQLite database") + (config.isReadOnly() ? " (read-only): " : ": ") +
+                config.getDatabaseName());
+}
+
+namespace {
+    const char* journalModeName(JournalMode mode) {
+        switch (mode) {
+            case JournalMode::Delete: return "DELETE";
+            case JournalMode::Truncate: return "TRUNCATE";
+            case JournalMode::Persist: return "PERSIST";
+            case JournalMode::Memory: return "MEMORY";
+            case JournalMode::WAL: return "WAL";
+            case JournalMode::Off: return "OFF";
+            default: return nullptr;
+        }
+    }
+
+    const char* synchronousName(SynchronousMode mode) {
+        switch (mode) {
+            case SynchronousMode::Off: return "OFF";
+            case SynchronousMode::Normal: return "NORMAL";
+            case SynchronousMode::Full: return "FULL";
+            case SynchronousMode::Extra: return "EXTRA";
+            default: return nullptr;
+        }
+    }
+
+    const char* tempStoreName(TempStore store) {
+        switch (store) {
+            case TempStore::File: return "FILE";
+            case TempStore::Memory: return "MEMORY";
+            default: return nullptr;
+        }
+    }
+
+    int captureFirstColumn(void* context, int columnCount, char** values, char**) {
+        if (columnCount > 0 && values[0]) {
+            *static_cast<std::string*>(context) = values[0];
+        }
+        return 0;
+    }
+}
+
+std::string SQLiteConnection::runPragma(const std::string& pragma) {
+    std::string result;
+    char* errorMessage = nullptr;
+    std::string sql = "PRAGMA " + pragma + ";";
+    if (sqlite3_exec(db, sql.c_str(), &captureFirstColumn, &result, &errorMessage) != SQLITE_OK) {
+        logger.warn("Failed to apply PRAGMA " + pragma + ": " + (errorMessage ? errorMessage : "unknown error"));
+    }
+    sqlite3_free(errorMessage);
+    return result;
+}
+
+void SQLiteConnection::applyTuning(const TuningProfile& tuning) {
+    bool readOnly = config.isReadOnly();
+
+    // page_size는 저널 모드를 WAL로 바꾸기 전(새 데이터베이스)에만 효과가 있습니다.
+    // 저널 모드와 페이지 크기는 파일에 기록되므로 읽기 전용 연결에서는 쓰기 연결의 설정을 따릅니다.
+    if (tuning.pageSize > 0 && !readOnly) {
+        runPragma("page_size=" + std::to_string(tuning.pageSize));
+    }
+    const char* journalMode = journalModeName(tuning.journalMode);
+    if (journalMode && !readOnly) {
+        std::string applied = runPragma(std::string("journal_mode=") + journalMode);
+        if (sqlite3_stricmp(applied.c_str(), journalMode) != 0) {
+            // 메모리 DB 등은 요청한 모드를 지원하지 않습니다.
+            logger.warn(std::string("Requested journal_mode=") + journalMode + ", database uses " + applied);
+        }
+    }
+    if (const char* synchronous = synchronousName(tuning.synchronous)) {
+        runPragma(std::string("synchronous=") + synchronous);
+    }
+    if (tuning.cacheSizeKiB > 0) {
+        // 음수 값은 페이지 수가 아닌 KiB 단위를 의미합니다.
+        runPragma("cache_size=-" + std::to_string(tuning.cacheSizeKiB));
+    }
+    if (tuning.mmapSize > 0) {
+        runPragma("mmap_size=" + std::to_string(tuning.mmapSize));
+    }
+    if (const char* tempStore = tempStoreName(tuning.tempStore)) {
+        runPragma(std::string("temp_store=") + tempStore);
+    }
+    if (tuning.busyTimeout.count() > 0) {
+        // sqlite3_busy_timeout의 고정 간격 대신 지터가 있는 지수 백오프로 기다립니다.
+        sqlite3_busy_handler(db, &SQLiteConnection::onBusy, this);
+    }
+    if (tuning.softHeapLimit > 0) {
+        sqlite3_soft_heap_limit64(tuning.softHeapLimit);
+    }
+}
+
+int SQLiteConnection::onBusy(void* context, int count) {
+    auto self = static_cast<SQLiteConnection*>(context);
+    auto now = std::chrono::steady_clock::now();
+    if (count == 0) {
+        self->busyStart = now;
+    }
+
+    auto delay = self->config.getRetryPolicy().backoff(static_cast<size_t>(count) + 1);
+    if (now + delay - self->busyStart > self->config.getTuningProfile().busyTimeout) {
+        return 0; // 대기 한도 초과: SQLITE_BUSY 반환
+    }
+    ++self->retries;
+    std::this_thread::sleep_for(delay);
+    return 1;
+}
+
+bool SQLiteConnection::isLockError(int rc) {
+    int primary = rc & 0xff;
+    return primary == SQLITE_BUSY || primary == SQLITE_LOCKED;
+}
+
+int SQLiteConnection::stepStatement(sqlite3_stmt* stmt, bool retryable) {
+    retries = 0;
+    const RetryPolicy& policy = config.getRetryPolicy();
+    for (size_t attempt = 1;; ++attempt) {
+        int rc = sqlite3_step(stmt);
+        if (!isLockError(rc) || !retryable || attempt >= policy.maxAttempts) {
+            return rc;
+        }
+        // 바인딩은 reset 후에도 유지됩니다.
+        sqlite3_reset(stmt);
+        ++retries;
+        logger.debug("Database is locked. Retrying statement (attempt " + std::to_string(attempt + 1) + ").");
+        std::this_thread::sleep_for(policy.backoff(attempt));
+    }
+}
+
+void SQLiteConnection::throwStepError(int rc, const std::string& context) {
+    std::string errorMessage = sqlite3_errmsg(db);
+    logger.error(context + ": " + errorMessage);
+    if (isLockError(rc)) {
+        throw LockAcquisitionException(errorMessage, retries);
+    }
+    throw QueryExecutionException(errorMessage);
+}
+
+void SQLiteConnection::installHooks() {
+    const char* filename = sqlite3_db_filename(db, "main");
+    databaseKey = filename ? filename : "";
+
+    sqlite3_update_hook(db, &SQLiteConnection::onUpdate, this);
+    sqlite3_commit_hook(db, &SQLiteConnection::onCommit, this);
+    sqlite3_rollback_hook(db, &SQLiteConnection::onRollback, this);
+    sqlite3_set_authorizer(db, &SQLiteConnection::onAuthorize, this);
+}
+
+void SQLiteConnection::onUpdate(void* context, int, const char*, const char* table, sqlite3_int64) {
+    auto self = static_cast<SQLiteConnection*>(context);
+    self->dirtyTables.insert(table);
+}
+
+int SQLiteConnection::onCommit(void* context) {
+    auto self = static_cast<SQLiteConnection*>(context);
+    // 커밋 직전에 버전을 올리고, 커밋이 끝난 뒤 한 번 더 올려 그 사이에 캐시된 결과도 무효화합니다.
+    auto& registry = TableVersionRegistry::getInstance();
+    for (const auto& table : self->dirtyTables) {
+        std::string key = TableVersionRegistry::makeKey(self->databaseKey, table);
+        registry.bump(key);
+        self->committedTables.push_back(std::move(key));
+    }
+    self->dirtyTables.clear();
+    return 0;
+}
+
+void SQLiteConnection::onRollback(void* context) {
+    auto self = static_cast<SQLiteConnection*>(context);
+    self->dirtyTables.clear();
+}
+
+int SQLiteConnection::onAuthorize(void* context, int action, const char* arg1, const char* arg2, const char*, const char*) {
+    auto self = static_cast<SQLiteConnection*>(context);
+    if (self->readTableCollector && action == SQLITE_READ && arg1) {
+        std::string key = TableVersionRegistry::makeKey(self->databaseKey, arg1);
+        auto& tables = *self->readTableCollector;
+        if (std::find(tables.begin(), tables.end(), key) == tables.end()) {
+            tables.push_back(std::move(key));
+        }
+    }
+
+    // update hook은 최적화된 DELETE FROM t(truncate)와 WITHOUT ROWID 테이블에서 호출되지 않으므로
+    // 문이 쓰는 테이블을 준비 시점에 함께 수집합니다.
+    const char* written = nullptr;
+    switch (action) {
+        case SQLITE_INSERT:
+        case SQLITE_UPDATE:
+        case SQLITE_DELETE:
+        case SQLITE_DROP_TABLE:
+        case SQLITE_DROP_TEMP_TABLE:
+            written = arg1;
+            break;
+        case SQLITE_ALTER_TABLE:
+            written = arg2;
+            break;
+        default:
+            break;
+    }
+    if (self->writeTableCollector && written) {
+        auto& tables = *self->writeTableCollector;
+        if (std::find(tables.begin(), tables.end(), written) == tables.end()) {
+            tables.emplace_back(written);
+        }
+    }
+    return SQLITE_OK;
+}
+
+void SQLiteConnection::publishCommittedTables() {
+    if (committedTables.empty()) {
+        return;
+    }
+    auto& registry = TableVersionRegistry::getInstance();
+    for (const auto& key : committedTables) {
+        registry.bump(key);
+    }
+    committedTables.clear();
 }
 
 void SQLiteConnection::disconnect() {
-    std::lock_guard<std::mutex> lock(connectionMutex);
+    auto lock = lockConnection();
     if (isConnected && db) {
-        sqlite3_close(db);
+        statementCache.clear();
+        // 아직 반납되지 않은 문이 있으면 모두 finalize 될 때까지 닫기를 미룹니다.
+        sqlite3_close_v2(db);
         db = nullptr;
         isConnected = false;
         logger.info("Disconnected from SQLite database.");
     }
 }
 
-void SQLiteConnection::finalizeStatement(sqlite3_stmt* stmt) {
-    if (stmt) {
-        sqlite3_finalize(stmt);
-    }
+bool SQLiteConnection::isValid() {
+    auto lock = lockConnection();
+    // 트랜잭션이 열린 채 반납된 연결은 다음 사용자의 작업을 그 트랜잭션에 섞게 되므로 재사용하지 않습니다.
+    return isConnected && db && sqlite3_get_autocommit(db) != 0;
+}
+
+namespace {
+    struct ParameterBinder {
+        sqlite3_stmt* stmt;
+        int index;
+
+        int operator()(std::nullptr_t) const {
+            return sqlite3_bind_null(stmt, index);
+        }
+        int operator()(int64_t value) const {
+            return sqlite3_bind_int64(stmt, index, value);
+        }
+        int operator()(double value) const {
+            return sqlite3_bind_double(stmt, index, value);
+        }
+        int operator()(const std::string& value) const {
+            return sqlite3_bind_text64(stmt, index, value.data(), value.size(), SQLITE_STATIC, SQLITE_UTF8);
+        }
+        // 데이터 포인터가 null이면 SQLite가 NULL로 바인딩하므로, 빈 값은 길이 0인 값으로 바인딩해 NULL과 구분합니다.
+        int operator()(std::string_view value) const {
+            return sqlite3_bind_text64(stmt, index, value.data() ? value.data() : "", value.size(), SQLITE_STATIC,
+                                       SQLITE_UTF8);
+        }
+        int operator()(const Blob& value) const {
+            if (value.empty()) {
+                return sqlite3_bind_zeroblob(stmt, index, 0);
+            }
+            return sqlite3_bind_blob64(stmt, index, value.data(), value.size(), SQLITE_STATIC);
+        }
+        int operator()(const BlobView& value) const {
+            if (!value.data || value.size == 0) {
+                return sqlite3_bind_zeroblob(stmt, index, 0);
+            }
+            return sqlite3_bind_blob64(stmt, index, value.data, value.size, SQLITE_STATIC);
+        }
+    };
+}
+
+int SQLiteConnection::bindValue(sqlite3_stmt* stmt, int index, const SQLParameter& value) {
+    return std::visit(ParameterBinder{stmt, index}, value);
 }
 
-void SQLiteConnection::bindParameters(sqlite3_stmt* stmt, const std::vector<std::any>& params) {
+void SQLiteConnection::bindParameters(sqlite3_stmt* stmt, const std::vector<SQLParameter>& params) {
+    // params는 실행이 끝날 때까지 유지되고 반납 시 바인딩이 해제되므로 값을 복사하지 않습니다.
     for (size_t i = 0; i < params.size(); ++i) {
         int index = static_cast<int>(i + 1);
-        const std::any& param = params[i];
-        if (param.type() == typeid(int)) {
-            sqlite3_bind_int(stmt, index, std::any_cast<int>(param));
-        } else if (param.type() == typeid(double)) {
-            sqlite3_bind_double(stmt, index, std::any_cast<double>(param));
-        } else if (param.type() == typeid(std::string)) {
-            const std::string& strValue = std::any_cast<std::string>(param);
-            sqlite3_bind_text(stmt, index, strValue.c_str(), -1, SQLITE_TRANSIENT);
-        } else if (param.type() == typeid(nullptr)) {
-            sqlite3_bind_null(stmt, index);
-        } else {
-            logger.error("Unsupported parameter type at index " + std::to_string(index));
-            throw QueryExecutionException("Unsupported parameter type at index " + std::to_string(index));
-        }
-    }
-}
-
-std::vector<std::map<std::string, std::string>> SQLiteConnection::executeQuery(
-    const std::string& query, const std::vector<std::any>& params) {
-    std::lock_guard<std::mutex> lock(connectionMutex);
+        if (bindValue(stmt, index, params[i]) != SQLITE_OK) {
+            std::string errorMessage = "Failed to bind parameter at index " + std::to_string(index) + ": " + sqlite3_errmsg(db);
+            logger.error(errorMessage);
+            throw QueryExecutionException(errorMessage);
+        }
+    }
+}
+
+ResultSet SQLiteConnection::executeQuery(
+    const std::string& query, const std::vector<SQLParameter>& params) {
+    auto lock = lockConnection();
     logger.debug("Executing query: " + query);
 
-    sqlite3_stmt* stmt = nullptr;
-    int rc = sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr);
-    if (rc != SQLITE_OK) {
-        std::string errorMessage = sqlite3_errmsg(db);
-        logger.error("Failed to prepare statement: " + errorMessage);
-        finalizeStatement(stmt);
-        throw QueryExecutionException(errorMessage);
-    }
+    sqlite3_stmt* stmt = prepareCachedStatement(query);
 
     try {
         bindParameters(stmt, params);
 
-        std::vector<std::map<std::string, std::string>> results;
-        int columnCount = sqlite3_column_count(stmt);
+        ResultSet results = createResultSet(stmt);
 
-        while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
-            std::map<std::string, std::string> row;
-            for (int i = 0; i < columnCount; ++i) {
-                std::string columnName = sqlite3_column_name(stmt, i);
-                const unsigned char* text = sqlite3_column_text(stmt, i);
-                std::string value = text ? reinterpret_cast<const char*>(text) : "";
-                row[columnName] = value;
-            }
-            results.push_back(row);
+        // 자동 커밋 상태의 문은 그 자체가 트랜잭션이므로 잠금 경합으로 실패해도 다시 실행할 수 있습니다.
+        int rc = stepStatement(stmt, sqlite3_get_autocommit(db) != 0);
+        while (rc == SQLITE_ROW) {
+            appendRow(stmt, results);
+            rc = sqlite3_step(stmt);
         }
 
         if (rc != SQLITE_DONE) {
-            std::string errorMessage = sqlite3_errmsg(db);
-            logger.error("Failed to execute query: " + errorMessage);
-            throw QueryExecutionException(errorMessage);
+            throwStepError(rc, "Failed to execute query");
         }
 
+        statementCache.release(stmt);
+        publishCommittedTables();
         logger.debug("Query executed successfully.");
         return results;
     } catch (...) {
-        finalizeStatement(stmt);
+        statementCache.release(stmt);
         throw;
     }
-
-    finalizeStatement(stmt);
 }
 
-int SQLiteConnection::executeUpdate(const std::string& query, const std::vector<std::any>& params) {
-    std::lock_guard<std::mutex> lock(connectionMutex);
+int SQLiteConnection::executeUpdate(const std::string& query, const std::vector<SQLParameter>& params) {
+    auto lock = lockConnection();
     logger.debug("Executing update: " + query);
 
-    sqlite3_stmt* stmt = nullptr;
-    int rc = sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr);
-    if (rc != SQLITE_OK) {
-        std::string errorMessage = sqlite3_errmsg(db);
-        logger.error("Failed to prepare statement: " + errorMessage);
-        finalizeStatement(stmt);
-        throw QueryExecutionException(errorMessage);
-    }
+    sqlite3_stmt* stmt = prepareCachedStatement(query);
 
     try {
         bindParameters(stmt, params);
 
-        rc = sqlite3_step(stmt);
+        // 자동 커밋 상태에서 실패한 문은 아무 것도 반영하지 않으므로 다시 실행해도 안전합니다.
+        int rc = stepStatement(stmt, sqlite3_get_autocommit(db) != 0);
         if (rc != SQLITE_DONE) {
-            std::string errorMessage = sqlite3_errmsg(db);
-            logger.error("Failed to execute update: " + errorMessage);
-            throw QueryExecutionException(errorMessage);
+            throwStepError(rc, "Failed to execute update");
         }
 
+        statementCache.release(stmt);
+        publishCommittedTables();
         int affectedRows = sqlite3_changes(db);
         logger.debug("Update executed successfully. Rows affected: " + std::to_string(affectedRows));
         return affectedRows;
     } catch (...) {
-        finalizeStatement(stmt);
+        statementCache.release(stmt);
         throw;
     }
+}
+
+sqlite3_stmt* SQLiteConnection::prepareCachedStatement(const std::string& query) {
+    // 새로 준비되는 문이면 authorizer가 읽고 쓰는 테이블을 수집합니다.
+    std::vector<std::string> readTables;
+    std::vector<std::string> writeTables;
+    readTableCollector = &readTables;
+    writeTableCollector = &writeTables;
+    sqlite3_stmt* stmt = nullptr;
+    try {
+        stmt = statementCache.acquire(db, query);
+    } catch (const QueryExecutionException& e) {
+        readTableCollector = nullptr;
+        writeTableCollector = nullptr;
+        logger.error("Failed to prepare statement: " + std::string(e.what()));
+        throw;
+    }
+    readTableCollector = nullptr;
+    writeTableCollector = nullptr;
+
+    if (!readTables.empty()) {
+        statementCache.setAttachment(stmt, READ_TABLES_KEY, std::make_shared<std::vector<std::string>>(std::move(readTables)));
+    }
+    if (!writeTables.empty()) {
+        statementCache.setAttachment(stmt, WRITE_TABLES_KEY, std::make_shared<std::vector<std::string>>(std::move(writeTables)));
+    }
 
-    finalizeStatement(stmt);
+    // 쓰는 문은 실행 전에 대상 테이블을 변경됨으로 표시합니다. 버전은 트랜잭션이 커밋될 때 올라가며,
+    // 실행이 실패해 롤백되면 표시도 함께 지워집니다.
+    if (auto written = std::static_pointer_cast<const std::vector<std::string>>(
+            statementCache.getAttachment(stmt, WRITE_TABLES_KEY))) {
+        dirtyTables.insert(written->begin(), written->end());
+    }
+    return stmt;
+}
+
+void SQLiteConnection::executeTransactionStatement(const std::string& statement) {
+    sqlite3_stmt* stmt = nullptr;
+    try {
+        stmt = statementCache.acquire(db, statement);
+    } catch (const QueryExecutionException& e) {
+        throw TransactionException(e.what());
+    }
+
+    // BEGIN과 COMMIT은 잠금 경합으로 실패해도 상태가 바뀌지 않으므로 다시 실행할 수 있습니다.
+    int rc = stepStatement(stmt, true);
+    statementCache.release(stmt);
+    publishCommittedTables();
+    if (rc != SQLITE_DONE) {
+        if (isLockError(rc)) {
+            throw LockAcquisitionException(sqlite3_errmsg(db), retries);
+        }
+        throw TransactionException(sqlite3_errmsg(db));
+    }
 }
 
 void SQLiteConnection::beginTransaction() {
-    std::lock_guard<std::mutex> lock(connectionMutex);
-    if (isInTransaction) {
+    auto lock = lockConnection();
+    // BEGIN이 executeUpdate로 실행된 경우도 있으므로 SQLite의 autocommit 상태를 기준으로 판단합니다.
+    if (!sqlite3_get_autocommit(db)) {
         logger.error("Transaction already in progress.");
         throw TransactionException("Transaction already in progress.");
     }
-    int rc = sqlite3_exec(db, "BEGIN TRANSACTION;", nullptr, nullptr, nullptr);
-    if (rc != SQLITE_OK) {
-        std::string errorMessage = sqlite3_errmsg(db);
-        logger.error("Failed to begin transaction: " + errorMessage);
-        throw TransactionException(errorMessage);
+    try {
+        executeTransactionStatement("BEGIN TRANSACTION;");
+    } catch (const DataAccessException& e) {
+        logger.error("Failed to begin transaction: " + std::string(e.what()));
+        throw;
     }
-    isInTransaction = true;
     logger.debug("Transaction started.");
 }
 
 void SQLiteConnection::commit() {
-    std::lock_guard<std::mutex> lock(connectionMutex);
-    if (!isInTransaction) {
+    auto lock = lockConnection();
+    if (sqlite3_get_autocommit(db)) {
         logger.error("No transaction in progress to commit.");
         throw TransactionException("No transaction in progress to commit.");
     }
-    int rc = sqlite3_exec(db, "COMMIT;", nullptr, nullptr, nullptr);
-    if (rc != SQLITE_OK) {
-        std::string errorMessage = sqlite3_errmsg(db);
-        logger.error("Failed to commit transaction: " + errorMessage);
-        throw TransactionException(errorMessage);
+    try {
+        executeTransactionStatement("COMMIT;");
+    } catch (const DataAccessException& e) {
+        logger.error("Failed to commit transaction: " + std::string(e.what()));
+        throw;
     }
-    isInTransaction = false;
     logger.debug("Transaction committed.");
 }
 
 void SQLiteConnection::rollback() {
-    std::lock_guard<std::mutex> lock(connectionMutex);
-    if (!isInTransaction) {
+    auto lock = lockConnection();
+    if (sqlite3_get_autocommit(db)) {
         logger.error("No transaction in progress to rollback.");
         throw TransactionException("No transaction in progress to rollback.");
     }
-    int rc = sqlite3_exec(db, "ROLLBACK;", nullptr, nullptr, nullptr);
+    try {
+        executeTransactionStatement("ROLLBACK;");
+    } catch (const DataAccessException& e) {
+        logger.error("Failed to rollback transaction: " + std::string(e.what()));
+        throw;
+    }
+    logger.debug("Transaction rolled back.");
+}
+
+void SQLiteConnection::beginReadTransaction(const std::shared_ptr<void>& snapshot) {
+    auto lock = lockConnection();
+    if (!sqlite3_get_autocommit(db)) {
+        logger.error("Transaction already in progress.");
+        throw TransactionException("Transaction already in progress.");
+    }
+#ifndef SQLITE_ENABLE_SNAPSHOT
+    if (snapshot) {
+        logger.error("Snapshots require SQLite built with SQLITE_ENABLE_SNAPSHOT.");
+        throw TransactionException("Snapshots require SQLite built with SQLITE_ENABLE_SNAPSHOT.");
+    }
+#endif
+    try {
+        executeTransactionStatement("BEGIN DEFERRED TRANSACTION;");
+    } catch (const DataAccessException& e) {
+        logger.error("Failed to begin read transaction: " + std::string(e.what()));
+        throw;
+    }
+
+    // DEFERRED 트랜잭션은 첫 읽기에서 읽기 시점이 정해지므로, 여기서 바로 고정합니다.
+    int rc = SQLITE_OK;
+#ifdef SQLITE_ENABLE_SNAPSHOT
+    if (snapshot) {
+        rc = sqlite3_snapshot_open(db, "main", static_cast<sqlite3_snapshot*>(snapshot.get()));
+    } else {
+        rc = sqlite3_exec(db, "SELECT 1 FROM sqlite_master LIMIT 1", nullptr, nullptr, nullptr);
+    }
+#else
+    rc = sqlite3_exec(db, "SELECT 1 FROM sqlite_master LIMIT 1", nullptr, nullptr, nullptr);
+#endif
     if (rc != SQLITE_OK) {
-        std::string errorMessage = sqlite3_errmsg(db);
-        logger.error("Failed to rollback transaction: " + errorMessage);
+        std::string errorMessage = snapshot ? "Failed to open snapshot: " : "Failed to start read transaction: ";
+        errorMessage += sqlite3_errmsg(db);
+        sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr);
+        logger.error(errorMessage);
         throw TransactionException(errorMessage);
     }
-    isInTransaction = false;
-    logger.debug("Transaction rolled back.");
+    logger.debug(snapshot ? "Read transaction started on snapshot." : "Read transaction started.");
+}
+
+std::shared_ptr<void> SQLiteConnection::captureSnapshot() {
+#ifdef SQLITE_ENABLE_SNAPSHOT
+    auto lock = lockConnection();
+    sqlite3_snapshot* snapshot = nullptr;
+    // WAL 모드의 읽기 트랜잭션 안에서만 성공합니다.
+    int rc = sqlite3_snapshot_get(db, "main", &snapshot);
+    if (rc != SQLITE_OK) {
+        std::string errorMessage = "Failed to capture snapshot: " + std::string(sqlite3_errmsg(db));
+        logger.error(errorMessage);
+        throw TransactionException(errorMessage);
+    }
+    return std::shared_ptr<void>(snapshot, [](void* handle) {
+        sqlite3_snapshot_free(static_cast<sqlite3_snapshot*>(handle));
+    });
+#else
+    return nullptr;
+#endif
+}
+
+int SQLiteConnection::getMaxParameterCount() {
+    auto lock = lockConnection();
+    // 컴파일 시 SQLITE_MAX_VARIABLE_NUMBER 또는 런타임에 낮춰진 한도
+    return sqlite3_limit(db, SQLITE_LIMIT_VARIABLE_NUMBER, -1);
 }
 
 void* SQLiteConnection::getNativeHandle() {
     return static_cast<void*>(db);
 }
 
+void* SQLiteConnection::acquireStatement(const std::string& query) {
+    auto lock = lockConnection();
+    return static_cast<void*>(prepareCachedStatement(query));
+}
+
+void SQLiteConnection::releaseStatement(void* statement) {
+    auto lock = lockConnection();
+    statementCache.release(static_cast<sqlite3_stmt*>(statement));
+    publishCommittedTables();
+}
+
+bool SQLiteConnection::fetchRow(void* statement) {
+    auto lock = lockConnection();
+    auto stmt = static_cast<sqlite3_stmt*>(statement);
+    // 첫 step만 다시 실행할 수 있습니다. (행을 읽기 시작한 문을 reset하면 처음부터 다시 읽음)
+    bool retryable = !sqlite3_stmt_busy(stmt) && sqlite3_get_autocommit(db) != 0;
+    int rc = stepStatement(stmt, retryable);
+    if (rc == SQLITE_ROW) {
+        return true;
+    }
+    if (rc != SQLITE_DONE) {
+        throwStepError(rc, "Failed to execute query");
+    }
+    return false;
+}
+
+std::shared_ptr<void> SQLiteConnection::getStatementAttachment(void* statement, const std::string& key) {
+    auto lock = lockConnection();
+    return statementCache.getAttachment(static_cast<sqlite3_stmt*>(statement), key);
+}
+
+void SQLiteConnection::setStatementAttachment(void* statement, const std::string& key, std::shared_ptr<void> value) {
+    auto lock = lockConnection();
+    statementCache.setAttachment(static_cast<sqlite3_stmt*>(statement), key, std::move(value));
+}
+
 std::string SQLiteConnection::extractTableName(const std::string& query) {
-    std::regex fromRegex("FROM\\s+([a-zA-Z0-9_]+)", std::regex::icase);
+    static const std::regex fromRegex("FROM\\s+([a-zA-Z0-9_]+)", std::regex::icase);
     std::smatch match;
     if (std::regex_search(query, match, fromRegex)) {
         return match[1].str();
     } else {
         return "";
     }
-}
\ No newline at end of file
+}
+
+ResultSet SQLiteConnection::createResultSet(sqlite3_stmt* stmt) {
+    int columnCount = sqlite3_column_count(stmt);
+    std::vector<std::string> columnNames;
+    columnNames.reserve(columnCount);
+    for (int i = 0; i < columnCount; ++i) {
+        columnNames.emplace_back(sqlite3_column_name(stmt, i));
+    }
+    return ResultSet(std::move(columnNames));
+}
+
+void SQLiteConnection::appendRow(sqlite3_stmt* stmt, ResultSet& resultSet) {
+    int columnCount = static_cast<int>(resultSet.columnCount());
+    for (int i = 0; i < columnCount; ++i) {
+        switch (sqlite3_column_type(stmt, i)) {
+            case SQLITE_INTEGER:
+                resultSet.appendInt64(sqlite3_column_int64(stmt, i));
+                break;
+            case SQLITE_FLOAT:
+                resultSet.appendDouble(sqlite3_column_double(stmt, i));
+                break;
+            case SQLITE_TEXT: {
+                const unsigned char* text = sqlite3_column_text(stmt, i);
+                resultSet.appendText(reinterpret_cast<const char*>(text), sqlite3_column_bytes(stmt, i));
+                break;
+            }
+            case SQLITE_BLOB: {
+                const void* blob = sqlite3_column_blob(stmt, i);
+                resultSet.appendBlob(blob, sqlite3_column_bytes(stmt, i));
+                break;
+            }
+            default:
+                resultSet.appendNull();
+                break;
+        }
+    }
+}
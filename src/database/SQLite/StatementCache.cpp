@@ -0,0 +1,120 @@
+#include "include/database/SQLite/StatementCache.h"
+#include "../QueryExecutionException/QueryExecutionException.h"
+
+StatementCache::StatementCache(size_t capacity)
+    : capacity(capacity) {}
+
+StatementCache::~StatementCache() {
+    for (auto& entry : entries) {
+        sqlite3_finalize(entry.stmt);
+    }
+}
+
+sqlite3_stmt* StatementCache::acquire(sqlite3* db, const std::string& sql) {
+    auto it = index.find(sql);
+    if (it != index.end() && !it->second->inUse) {
+        // 최근 사용 위치로 이동
+        entries.splice(entries.begin(), entries, it->second);
+        it->second->inUse = true;
+        return it->second->stmt;
+    }
+
+    sqlite3_stmt* stmt = nullptr;
+    int rc = sqlite3_prepare_v2(db, sql.c_str(), static_cast<int>(sql.size()), &stmt, nullptr);
+    if (rc != SQLITE_OK) {
+        std::string errorMessage = sqlite3_errmsg(db);
+        sqlite3_finalize(stmt);
+        throw QueryExecutionException(errorMessage);
+    }
+
+    // 같은 SQL이 이미 사용 중이면 (중첩 실행) 캐시하지 않고 반납 시 finalize 합니다.
+    if (it != index.end() || capacity == 0) {
+        return stmt;
+    }
+
+    entries.push_front(Entry{sql, stmt, true, {}});
+    index[sql] = entries.begin();
+    byStatement[stmt] = entries.begin();
+    evictIfNeeded();
+    return stmt;
+}
+
+void StatementCache::release(sqlite3_stmt* stmt) {
+    if (!stmt) {
+        return;
+    }
+
+    auto it = byStatement.find(stmt);
+    if (it == byStatement.end()) {
+        sqlite3_finalize(stmt);
+        return;
+    }
+
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    it->second->inUse = false;
+    evictIfNeeded();
+}
+
+void StatementCache::clear() {
+    // 사용 중인 문은 캐시에서 분리만 하고, 반납될 때 finalize 되도록 합니다.
+    for (auto& entry : entries) {
+        if (!entry.inUse) {
+            sqlite3_finalize(entry.stmt);
+        }
+    }
+    entries.clear();
+    index.clear();
+    byStatement.clear();
+}
+
+std::shared_ptr<void> StatementCache::getAttachment(sqlite3_stmt* stmt, const std::string& key) const {
+    auto it = byStatement.find(stmt);
+    if (it == byStatement.end()) {
+        return nullptr;
+    }
+    for (const auto& attachment : it->second->attachments) {
+        if (attachment.first == key) {
+            return attachment.second;
+        }
+    }
+    return nullptr;
+}
+
+void StatementCache::setAttachment(sqlite3_stmt* stmt, const std::string& key, std::shared_ptr<void> value) {
+    // 캐시되지 않은 문은 곧 finalize 되므로 보관하지 않습니다.
+    auto it = byStatement.find(stmt);
+    if (it == byStatement.end()) {
+        return;
+    }
+    for (auto& attachment : it->second->attachments) {
+        if (attachment.first == key) {
+            attachment.second = std::move(value);
+            return;
+        }
+    }
+    it->second->attachments.emplace_back(key, std::move(value));
+}
+
+size_t StatementCache::size() const {
+    return entries.size();
+}
+
+size_t StatementCache::getCapacity() const {
+    return capacity;
+}
+
+void StatementCache::evictIfNeeded() {
+    // 가장 오래 사용되지 않은 문부터 제거하되, 사용 중인 문은 건너뜁니다.
+    auto it = entries.end();
+    while (entries.size() > capacity && it != entries.begin()) {
+        --it;
+        if (it->inUse) {
+            continue;
+        }
+        sqlite3_finalize(it->stmt);
+        index.erase(it->sql);
+        byStatement.erase(it->stmt);
+        it = entries.erase(it);
+    }
+}
@@ -0,0 +1,48 @@
+#include "include/database/TuningProfile.h"
+#include "include/utils/ORMException/ConfigurationException/ConfigurationException.h"
+
+TuningProfile TuningProfile::preset(const std::string& name) {
+    if (name == "default") {
+        return TuningProfile();
+    }
+    if (name == "durable") {
+        return durable();
+    }
+    if (name == "throughput") {
+        return throughput();
+    }
+    if (name == "read-replica") {
+        return readReplica();
+    }
+    throw ConfigurationException("Unknown tuning profile: " + name);
+}
+
+TuningProfile TuningProfile::durable() {
+    TuningProfile profile;
+    profile.journalMode = JournalMode::WAL;
+    profile.synchronous = SynchronousMode::Full;
+    profile.cacheSizeKiB = 16 * 1024;
+    profile.tempStore = TempStore::Memory;
+    profile.busyTimeout = std::chrono::seconds(5);
+    return profile;
+}
+
+TuningProfile TuningProfile::throughput() {
+    TuningProfile profile;
+    profile.journalMode = JournalMode::WAL;
+    profile.synchronous = SynchronousMode::Normal;
+    profile.cacheSizeKiB = 64 * 1024;
+    profile.mmapSize = 256LL * 1024 * 1024;
+    profile.tempStore = TempStore::Memory;
+    profile.busyTimeout = std::chrono::seconds(5);
+    return profile;
+}
+
+TuningProfile TuningProfile::readReplica() {
+    TuningProfile profile;
+    profile.cacheSizeKiB = 32 * 1024;
+    profile.mmapSize = 256LL * 1024 * 1024;
+    profile.tempStore = TempStore::Memory;
+    profile.busyTimeout = std::chrono::seconds(5);
+    return profile;
+}
@@ -8,30 +8,95 @@ EntityMapper& EntityMapper::getInstance() {
 
 EntityMapper::EntityMapper()
     : logger(Logger::getInstance()) {
+    auto initial = std::make_shared<Registry>();
+    initial->byTypeId.push_back(nullptr);
+    std::atomic_store(&current, std::shared_ptr<const Registry>(std::move(initial)));
     logger.debug("EntityMapper created.");
 }
 
 void EntityMapper::registerEntity(const EntityMapping& mapping) {
-    mappings[mapping.entityName] = mapping;
-    logger.info("Entity registered: " + mapping.entityName);
+    std::lock_guard<std::mutex> lock(registerMutex);
+    auto previous = std::atomic_load(&current);
+
+    auto registered = std::make_shared<EntityMapping>(mapping);
+    registered->sql = buildSQL(*registered);
+
+    // 기존 스냅샷을 복사한 뒤 변경하여 새 스냅샷으로 게시합니다.
+    auto next = std::make_shared<Registry>(*previous);
+    auto existing = next->byEntityName.find(mapping.entityName);
+    if (existing != next->byEntityName.end()) {
+        // 재등록 시 타입 ID를 유지하고 이전 테이블 이름 색인을 제거합니다.
+        registered->typeId = existing->second->typeId;
+        next->byTableName.erase(existing->second->tableName);
+    } else {
+        registered->typeId = static_cast<uint32_t>(next->byTypeId.size());
+        next->byTypeId.push_back(nullptr);
+    }
+
+    next->byEntityName[registered->entityName] = registered;
+    next->byTableName[registered->tableName] = registered;
+    next->byTypeId[registered->typeId] = registered;
+
+    std::atomic_store(&current, std::shared_ptr<const Registry>(std::move(next)));
+    logger.info("Entity registered: " + mapping.entityName + " (typeId: " + std::to_string(registered->typeId) + ")");
 }
 
-std::shared_ptr<EntityMapping> EntityMapper::getMapping(const std::string& entityName) {
-    auto it = mappings.find(entityName);
-    if (it != mappings.end()) {
-        return std::make_shared<EntityMapping>(it->second);
+EntitySQL EntityMapper::buildSQL(const EntityMapping& mapping) {
+    EntitySQL sql;
+
+    std::string setClause;
+    sql.rowPlaceholder = "(";
+    for (size_t i = 0; i < mapping.fields.size(); ++i) {
+        const std::string& column = mapping.fields[i].columnName;
+        if (i > 0) {
+            sql.columnList += ", ";
+            sql.rowPlaceholder += ", ";
+            setClause += ", ";
+        }
+        sql.columnList += column;
+        sql.rowPlaceholder += "?";
+        setClause += column + " = ?";
+    }
+    sql.rowPlaceholder += ")";
+
+    const std::string whereId = " WHERE " + mapping.idColumnName + " = ?;";
+    if (mapping.fields.empty()) {
+        sql.insert = "INSERT INTO " + mapping.tableName + " DEFAULT VALUES;";
+    } else {
+        sql.insert = "INSERT INTO " + mapping.tableName + " (" + sql.columnList + ") VALUES " + sql.rowPlaceholder + ";";
+        sql.update = "UPDATE " + mapping.tableName + " SET " + setClause + whereId;
+    }
+    sql.remove = "DELETE FROM " + mapping.tableName + whereId;
+    sql.selectById = "SELECT * FROM " + mapping.tableName + whereId;
+
+    return sql;
+}
+
+std::shared_ptr<const EntityMapping> EntityMapper::getMapping(const std::string& entityName) const {
+    auto registry = std::atomic_load(&current);
+    auto it = registry->byEntityName.find(entityName);
+    if (it != registry->byEntityName.end()) {
+        return it->second;
     } else {
         logger.error("No mapping found for entity: " + entityName);
         return nullptr;
     }
 }
 
-std::shared_ptr<EntityMapping> EntityMapper::getMappingByTableName(const std::string& tableName) {
-    for (const auto& pair : mappings) {
-        if (pair.second.tableName == tableName) {
-            return std::make_shared<EntityMapping>(pair.second);
-        }
+std::shared_ptr<const EntityMapping> EntityMapper::getMappingByTableName(const std::string& tableName) const {
+    auto registry = std::atomic_load(&current);
+    auto it = registry->byTableName.find(tableName);
+    if (it != registry->byTableName.end()) {
+        return it->second;
     }
     logger.error("No mapping found for table: " + tableName);
     return nullptr;
-}
\ No newline at end of file
+}
+
+std::shared_ptr<const EntityMapping> EntityMapper::getMappingByTypeId(uint32_t typeId) const {
+    auto registry = std::atomic_load(&current);
+    if (typeId < registry->byTypeId.size()) {
+        return registry->byTypeId[typeId];
+    }
+    return nullptr;
+}
@@ -0,0 +1,33 @@
+#include "include/mapping/LazyRelation.h"
+#include "include/mapping/IEntity.h"
+#include "query/FetchGroup.h"
+#include "ORMException/LazyInitializationException/LazyInitializationException.h"
+
+LazyRelation::LazyRelation(std::shared_ptr<FetchGroup> group, size_t index, std::string relationName)
+    : group(std::move(group)), index(index), relationName(std::move(relationName)) {}
+
+std::vector<std::shared_ptr<IEntity>> LazyRelation::get() const {
+    if (!group) {
+        throw LazyInitializationException("Cannot load relationship '" + relationName +
+                                          "': the entity was not loaded by a query.");
+    }
+    return group->getRelated(index, relationName);
+}
+
+std::shared_ptr<IEntity> LazyRelation::getOne() const {
+    auto related = get();
+    return related.empty() ? nullptr : related.front();
+}
+
+bool LazyRelation::isLoaded() const {
+    return group && group->isLoaded(relationName);
+}
+
+LazyRelation IEntity::relation(const std::string& relationName) const {
+    return LazyRelation(fetchGroup, fetchIndex, relationName);
+}
+
+void IEntity::attachFetchGroup(std::shared_ptr<FetchGroup> group, size_t index) {
+    fetchGroup = std::move(group);
+    fetchIndex = index;
+}
@@ -0,0 +1,248 @@
+#include "query/FetchGroup.h"
+#include "query/MappingPlan.h"
+#include "ORMException/LazyInitializationException/LazyInitializationException.h"
+#include "ORMException/MappingException/MappingException.h"
+#include <algorithm>
+#include <unordered_set>
+
+FetchGroup::FetchGroup(std::shared_ptr<const EntityMapping> mapping, std::shared_ptr<IDatabaseConnection> connection,
+                       FetchContext context)
+    : mapping(std::move(mapping)), context(std::move(context)), logger(Logger::getInstance()) {
+    if (!this->context.sessionBound) {
+        this->connection = std::move(connection);
+    }
+    size_t relationCount = this->mapping->relationships.size();
+    foreignKeyColumns.assign(relationCount, -1);
+    foreignKeys.resize(relationCount);
+    foreignKeysFetched.assign(relationCount, false);
+}
+
+std::shared_ptr<FetchGroup> FetchGroup::create(std::shared_ptr<const EntityMapping> mapping,
+                                               std::shared_ptr<IDatabaseConnection> connection, FetchContext context) {
+    auto group = std::make_shared<FetchGroup>(std::move(mapping), std::move(connection), std::move(context));
+    group->owner = group;
+    return group;
+}
+
+bool FetchGroup::ownsForeignKey(const Relationship& relationship) {
+    return relationship.type == "ManyToOne" ||
+           (relationship.type == "OneToOne" && relationship.mappedBy.empty() && !relationship.joinColumn.empty());
+}
+
+void FetchGroup::setResultColumns(const std::vector<std::string>& columnNames) {
+    for (size_t r = 0; r < mapping->relationships.size(); ++r) {
+        const Relationship& relationship = mapping->relationships[r];
+        if (!ownsForeignKey(relationship)) {
+            continue;
+        }
+        auto it = std::find(columnNames.begin(), columnNames.end(), relationship.joinColumn);
+        foreignKeyColumns[r] = it != columnNames.end() ? static_cast<int>(it - columnNames.begin()) : -1;
+    }
+}
+
+bool FetchGroup::isLoaded(const std::string& relationName) const {
+    for (size_t r = 0; r < mapping->relationships.size(); ++r) {
+        if (mapping->relationships[r].relationshipName == relationName) {
+            return loaded.find(r) != loaded.end();
+        }
+    }
+    return false;
+}
+
+std::vector<std::shared_ptr<IEntity>> FetchGroup::getRelated(size_t index, const std::string& relationName) {
+    size_t relationIndex = mapping->relationships.size();
+    for (size_t r = 0; r < mapping->relationships.size(); ++r) {
+        if (mapping->relationships[r].relationshipName == relationName) {
+            relationIndex = r;
+            break;
+        }
+    }
+    if (relationIndex == mapping->relationships.size()) {
+        throw MappingException("No relationship '" + relationName + "' on entity: " + mapping->entityName);
+    }
+    if (index >= ids.size()) {
+        throw LazyInitializationException("Entity is not part of this fetch group: " + mapping->entityName);
+    }
+
+    auto it = loaded.find(relationIndex);
+    if (it == loaded.end()) {
+        load(relationIndex);
+        it = loaded.find(relationIndex);
+    }
+
+    std::vector<std::shared_ptr<IEntity>> related;
+    related.reserve(it->second[index].size());
+    for (const auto& entry : it->second[index]) {
+        auto entity = entry.owned ? entry.owned : entry.shared.lock();
+        if (!entity) {
+            throw LazyInitializationException("Cannot access relationship '" + relationName +
+                                              "': the related entity was released with its session.");
+        }
+        related.push_back(std::move(entity));
+    }
+    return related;
+}
+
+void FetchGroup::setFetched(size_t relationIndex, size_t index, std::shared_ptr<IEntity> related, bool sessionOwned) {
+    RelatedLists& lists = loaded[relationIndex];
+    if (lists.size() < ids.size()) {
+        lists.resize(ids.size());
+    }
+    lists[index].clear();
+    if (related) {
+        RelatedEntity entry;
+        if (sessionOwned) {
+            entry.shared = related;
+        } else {
+            entry.owned = std::move(related);
+        }
+        lists[index].push_back(std::move(entry));
+    }
+}
+
+size_t FetchGroup::maxKeysPerQuery(IDatabaseConnection& connection) const {
+    size_t maxParameters = static_cast<size_t>(std::max(1, connection.getMaxParameterCount()));
+    return std::max<size_t>(1, std::min(context.batchSize, maxParameters));
+}
+
+std::shared_ptr<IDatabaseConnection> FetchGroup::acquireConnection(const std::string& relationName) const {
+    if (!context.sessionBound) {
+        return connection;
+    }
+    auto current = context.sessionLifetime.expired() || !context.sessionConnection ? nullptr : context.sessionConnection();
+    if (!current) {
+        throw LazyInitializationException("Cannot load relationship '" + relationName + "': the session is closed.");
+    }
+    return current;
+}
+
+std::string FetchGroup::inverseJoinColumn(const EntityMapping& owner, const Relationship& relationship,
+                                          const EntityMapping& target) {
+    // 대상 엔티티의 mappedBy 관계가 외래 키 컬럼을 가집니다. joinColumn이 지정되어 있으면 그것을 사용합니다.
+    if (!relationship.joinColumn.empty()) {
+        return relationship.joinColumn;
+    }
+    for (const auto& inverse : target.relationships) {
+        if (inverse.relationshipName == relationship.mappedBy && !inverse.joinColumn.empty()) {
+            return inverse.joinColumn;
+        }
+    }
+    throw MappingException("Cannot resolve join column of relationship '" + relationship.relationshipName +
+                           "' on entity: " + owner.entityName);
+}
+
+void FetchGroup::fetchForeignKeys(IDatabaseConnection& connection, size_t relationIndex) {
+    const Relationship& relationship = mapping->relationships[relationIndex];
+    std::unordered_map<std::string, std::string> keyById;
+
+    size_t chunkSize = maxKeysPerQuery(connection);
+    std::vector<SQLParameter> params;
+    for (size_t offset = 0; offset < ids.size(); offset += chunkSize) {
+        size_t count = std::min(chunkSize, ids.size() - offset);
+        std::string sql = "SELECT " + mapping->idColumnName + ", " + relationship.joinColumn + " FROM " +
+                          mapping->tableName + " WHERE " + mapping->idColumnName + " IN (";
+        params.clear();
+        for (size_t i = 0; i < count; ++i) {
+            sql += i > 0 ? ", ?" : "?";
+            params.push_back(ids[offset + i]);
+        }
+        sql += ");";
+
+        ResultSet rows = connection.executeQuery(sql, params);
+        for (size_t row = 0; row < rows.rowCount(); ++row) {
+            keyById[rows.getString(row, 0)] = rows.getString(row, 1);
+        }
+    }
+
+    auto& keys = foreignKeys[relationIndex];
+    keys.clear();
+    keys.reserve(ids.size());
+    for (const auto& id : ids) {
+        auto it = keyById.find(id);
+        keys.push_back(it != keyById.end() ? it->second : std::string());
+    }
+    foreignKeysFetched[relationIndex] = true;
+}
+
+void FetchGroup::load(size_t relationIndex) {
+    const Relationship& relationship = mapping->relationships[relationIndex];
+    auto connection = acquireConnection(relationship.relationshipName);
+
+    auto target = EntityMapper::getInstance().getMapping(relationship.targetEntity);
+    if (!target) {
+        throw MappingException("No mapping found for related entity: " + relationship.targetEntity);
+    }
+
+    // 소유 쪽이면 외래 키 값으로 대상 ID를, 반대쪽이면 소유 ID로 대상의 외래 키 컬럼을 조회합니다.
+    bool owning = ownsForeignKey(relationship);
+    std::string keyColumn;
+    if (owning) {
+        keyColumn = target->idColumnName;
+        if (foreignKeyColumns[relationIndex] < 0 && !foreignKeysFetched[relationIndex]) {
+            fetchForeignKeys(*connection, relationIndex);
+        }
+    } else if (relationship.type == "OneToMany" || relationship.type == "OneToOne") {
+        keyColumn = inverseJoinColumn(*mapping, relationship, *target);
+    } else {
+        // 조인 테이블 정보가 매핑에 없으므로 다대다 관계는 지원하지 않습니다.
+        throw MappingException("Lazy loading is not supported for relationship type '" + relationship.type +
+                               "': " + relationship.relationshipName);
+    }
+    const std::vector<std::string>& ownerKeys = owning ? foreignKeys[relationIndex] : ids;
+
+    std::vector<std::string> keys;
+    std::unordered_set<std::string> seen;
+    for (const auto& key : ownerKeys) {
+        if (!key.empty() && seen.insert(key).second) {
+            keys.push_back(key);
+        }
+    }
+
+    // 불러온 엔티티도 하나의 묶음으로 만들어 그 관계 역시 일괄 로딩되게 합니다.
+    auto relatedGroup = create(target, connection, context);
+    std::unordered_map<std::string, std::vector<std::shared_ptr<IEntity>>> byKey;
+    size_t chunkSize = maxKeysPerQuery(*connection);
+    size_t queries = 0;
+    std::vector<SQLParameter> params;
+    for (size_t offset = 0; offset < keys.size(); offset += chunkSize) {
+        size_t count = std::min(chunkSize, keys.size() - offset);
+        // 같은 크기의 청크는 같은 SQL이므로 연결의 Statement 캐시에서 재사용됩니다.
+        std::string sql = "SELECT * FROM " + target->tableName + " WHERE " + keyColumn + " IN (";
+        params.clear();
+        for (size_t i = 0; i < count; ++i) {
+            sql += i > 0 ? ", ?" : "?";
+            params.push_back(keys[offset + i]);
+        }
+        sql += ");";
+
+        ResultSet rows = connection->executeQuery(sql, params);
+        ++queries;
+        int keyIndex = rows.findColumn(keyColumn);
+        if (keyIndex < 0) {
+            throw MappingException("Join column not found in " + target->tableName + ": " + keyColumn);
+        }
+        auto plan = MappingPlan::forColumns(target, rows.getColumnNames());
+        relatedGroup->setResultColumns(rows.getColumnNames());
+        for (size_t row = 0; row < rows.rowCount(); ++row) {
+            auto readValue = [&rows, row](size_t column) { return rows.getValue(row, column); };
+            auto entity = plan->materialize(readValue);
+            relatedGroup->add(entity, readValue);
+            byKey[rows.getString(row, static_cast<size_t>(keyIndex))].push_back(std::move(entity));
+        }
+    }
+
+    // 새로 만든 엔티티이므로 그룹이 소유합니다.
+    RelatedLists related(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        auto it = byKey.find(ownerKeys[i]);
+        if (it != byKey.end()) {
+            for (auto& entity : it->second) {
+                related[i].push_back(RelatedEntity{entity, {}});
+            }
+        }
+    }
+    loaded.emplace(relationIndex, std::move(related));
+
+    logger.debug("Relationship batch-loaded: " + mapping->entityName + "." + relationship.relationshipName + " (" +
+                 std::to_string(ids.size()) + " entities, " + std::to_string(queries) + " queries)");
+}
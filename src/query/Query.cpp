@@ -1,165 +1,367 @@
 #include "query/Query.h"
 #include <regex>
+#include <functional>
 #include "ORMException/DataAccessException/QueryExecutionException/QueryExecutionException.h"
 #include "ORMException/MappingException/MappingException.h"
 
 Query::Query(std::shared_ptr<IDatabaseConnection> connection, const std::string& queryString)
-    : connection(connection), queryString(queryString), logger(Logger::getInstance()), stmt(nullptr) {
+    : connection(connection), queryString(queryString), parameters(std::make_shared<ParameterMap>()),
+      cacheable(false), logger(Logger::getInstance()) {
     logger.debug("Query created with query string: " + queryString);
 }
 
 Query::~Query() {
-    if (stmt) {
-        sqlite3_finalize(stmt);
-        stmt = nullptr;
-    }
     logger.debug("Query destroyed.");
 }
 
-void Query::setParameter(const std::string& name, const std::string& value) {
-    parameters[name] = value;
-    logger.debug("Parameter set: " + name + " = " + value);
+const std::string Query::PARAMETER_NAMES_KEY = "Query.parameterNames";
+
+void Query::setParameterValue(const std::string& name, SQLParameter value) {
+    // 열린 커서가 이전 값을 참조하고 있으면 맵을 복사한 뒤 변경합니다.
+    if (parameters.use_count() > 1) {
+        parameters = std::make_shared<ParameterMap>(*parameters);
+    }
+    (*parameters)[name] = std::move(value);
+    logger.debug("Parameter set: " + name);
 }
 
-void Query::prepareAndBind() {
-    std::lock_guard<std::mutex> lock(cacheMutex);
+void Query::setCacheable(bool value) {
+    cacheable = value;
+}
 
-    if (stmt) {
-        sqlite3_reset(stmt);
-    } else {
-        // 캐시에서 Prepared Statement 검색
-        auto it = statementCache.find(queryString);
-        if (it != statementCache.end()) {
-            stmt = it->second;
-            sqlite3_reset(stmt);
-        } else {
-            sqlite3* db = connection->getNativeHandle();
-            int rc = sqlite3_prepare_v2(db, queryString.c_str(), -1, &stmt, nullptr);
-            if (rc != SQLITE_OK) {
-                std::string errorMessage = sqlite3_errmsg(db);
-                logger.error("Failed to prepare statement: " + errorMessage);
-                throw QueryExecutionException(errorMessage);
+std::string Query::resultCacheKey(const std::string& kind) const {
+    if (!cacheable) {
+        return "";
+    }
+    auto db = static_cast<sqlite3*>(connection->getNativeHandle());
+    // 메모리 DB는 연결마다 별개이고, 트랜잭션 중에는 아직 커밋되지 않은 변경이 보이므로 캐시하지 않습니다.
+    const char* database = db ? sqlite3_db_filename(db, "main") : nullptr;
+    if (!database || database[0] == '\0' || !sqlite3_get_autocommit(db)) {
+        return "";
+    }
+    return QueryResultCache::makeKey(kind, database, queryString, *parameters);
+}
+
+ResultSet Query::fetchAll(QueryCursor& cursor) {
+    ResultSet results = cursor.createResultSet();
+    while (cursor.next()) {
+        cursor.appendRow(results);
+    }
+    return results;
+}
+
+namespace {
+
+bool startsWith(const std::string& text, const std::string& prefix) {
+    return text.compare(0, prefix.size(), prefix) == 0;
+}
+
+} // namespace
+
+class Query::JoinedRows {
+public:
+    using ValueReader = std::function<ColumnValue(size_t)>;
+
+    JoinedRows(const Query& query, const std::vector<std::string>& columnNames) : identityMap(query.fetchContext.identityMap) {
+        // 조인 대상 컬럼은 접두사를 뗀 이름으로, 나머지는 루트 컬럼으로 매핑합니다.
+        std::vector<std::string> rootNames = columnNames;
+        for (const auto& join : query.joinFetches) {
+            Join state;
+            state.relationIndex = join.relationIndex;
+            state.mapping = join.target;
+            state.idColumn = -1;
+            std::vector<std::string> targetNames(columnNames.size());
+            for (size_t i = 0; i < columnNames.size(); ++i) {
+                if (startsWith(columnNames[i], join.columnPrefix)) {
+                    targetNames[i] = columnNames[i].substr(join.columnPrefix.size());
+                    rootNames[i].clear();
+                    if (targetNames[i] == join.target->idColumnName) {
+                        state.idColumn = static_cast<int>(i);
+                    }
+                }
             }
-            statementCache[queryString] = stmt;
+            if (state.idColumn < 0) {
+                throw MappingException("Join column not found in result: " + join.columnPrefix + join.target->idColumnName);
+            }
+            state.plan = MappingPlan::forColumns(join.target, targetNames);
+            state.group = FetchGroup::create(join.target, query.connection, query.fetchContext);
+            state.group->setResultColumns(targetNames);
+            joins.push_back(std::move(state));
+        }
+        rootPlan = MappingPlan::forColumns(query.joinRoot, rootNames);
+        rootGroup = FetchGroup::create(query.joinRoot, query.connection, query.fetchContext);
+        rootGroup->setResultColumns(rootNames);
+    }
+
+    std::shared_ptr<const MappingPlan> getRootPlan() const {
+        return rootPlan;
+    }
+
+    std::shared_ptr<IEntity> read(const ValueReader& readValue) {
+        auto root = rootPlan->materialize(readValue);
+        size_t index = rootGroup->add(root, readValue);
+        for (auto& join : joins) {
+            bool sessionOwned = false;
+            auto related = readRelated(join, readValue, sessionOwned);
+            rootGroup->setFetched(join.relationIndex, index, std::move(related), sessionOwned);
+        }
+        return root;
+    }
+
+private:
+    struct Join {
+        size_t relationIndex;
+        std::shared_ptr<const EntityMapping> mapping;
+        std::shared_ptr<MappingPlan> plan;
+        std::shared_ptr<FetchGroup> group;
+        int idColumn;
+        // 결과 안에서 같은 ID는 한 번만 생성. 값은 (엔티티, 세션에 이미 있던 인스턴스인지)
+        std::unordered_map<std::string, std::pair<std::shared_ptr<IEntity>, bool>> byId;
+    };
+
+    // sessionOwned: 세션의 1차 캐시에 이미 있던 인스턴스를 반환했는지
+    std::shared_ptr<IEntity> readRelated(Join& join, const ValueReader& readValue, bool& sessionOwned) {
+        ColumnValue id = readValue(static_cast<size_t>(join.idColumn));
+        if (id.type == ColumnType::Null) {
+            return nullptr; // LEFT JOIN에 대응하는 행이 없음
+        }
+        std::string key = id.toString();
+        auto it = join.byId.find(key);
+        if (it != join.byId.end()) {
+            sessionOwned = it->second.second;
+            return it->second.first;
         }
+
+        auto entity = join.plan->materialize(readValue);
+        // 세션에 같은 엔티티가 있으면 그 인스턴스를 사용합니다. (변경 중인 상태를 덮어쓰지 않음)
+        auto resolved = identityMap ? identityMap(*join.mapping, entity) : entity;
+        sessionOwned = resolved != entity;
+        if (!sessionOwned) {
+            join.group->add(entity, readValue);
+        }
+        join.byId.emplace(std::move(key), std::make_pair(resolved, sessionOwned));
+        return resolved;
     }
 
-    // 모든 파라미터를 바인딩
+    std::function<std::shared_ptr<IEntity>(const EntityMapping&, const std::shared_ptr<IEntity>&)> identityMap;
+    std::shared_ptr<MappingPlan> rootPlan;
+    std::shared_ptr<FetchGroup> rootGroup;
+    std::vector<Join> joins;
+};
+
+std::shared_ptr<Query::JoinedRows> Query::createJoinedRows(const std::vector<std::string>& columnNames) const {
+    return std::make_shared<JoinedRows>(*this, columnNames);
+}
+
+void Query::setJoinFetches(std::shared_ptr<const EntityMapping> root, std::vector<JoinFetch> joins) {
+    joinRoot = std::move(root);
+    joinFetches = std::move(joins);
+}
+
+std::vector<std::shared_ptr<IEntity>> Query::materialize(const ResultSet& rows, const MappingPlan& plan) {
+    if (!joinFetches.empty()) {
+        auto joined = createJoinedRows(rows.getColumnNames());
+        std::vector<std::shared_ptr<IEntity>> entities;
+        entities.reserve(rows.rowCount());
+        for (size_t row = 0; row < rows.rowCount(); ++row) {
+            entities.push_back(joined->read([&rows, row](size_t column) { return rows.getValue(row, column); }));
+        }
+        return entities;
+    }
+
+    auto group = createFetchGroup(plan.mapping, rows.getColumnNames());
+    std::vector<std::shared_ptr<IEntity>> entities;
+    entities.reserve(rows.rowCount());
+    for (size_t row = 0; row < rows.rowCount(); ++row) {
+        auto readValue = [&rows, row](size_t column) { return rows.getValue(row, column); };
+        entities.push_back(plan.materialize(readValue));
+        if (group) {
+            group->add(entities.back(), readValue);
+        }
+    }
+    return entities;
+}
+
+std::shared_ptr<FetchGroup> Query::createFetchGroup(const std::shared_ptr<const EntityMapping>& mapping,
+                                                    const std::vector<std::string>& columnNames) const {
+    // 관계가 없는 엔티티는 그룹을 만들지 않습니다.
+    if (mapping->relationships.empty()) {
+        return nullptr;
+    }
+    auto group = FetchGroup::create(mapping, connection, fetchContext);
+    group->setResultColumns(columnNames);
+    return group;
+}
+
+void Query::setFetchContext(FetchContext context) {
+    fetchContext = std::move(context);
+}
+
+std::shared_ptr<const std::vector<std::string>> Query::getParameterNames(sqlite3_stmt* stmt) {
+    auto names = std::static_pointer_cast<const std::vector<std::string>>(
+        connection->getStatementAttachment(stmt, PARAMETER_NAMES_KEY));
+    if (names) {
+        return names;
+    }
+
+    // 파라미터 인덱스는 1부터 시작합니다. (0번은 사용하지 않음)
     int paramCount = sqlite3_bind_parameter_count(stmt);
-    for (int i = 0; i < paramCount; i++) {
+    auto resolved = std::make_shared<std::vector<std::string>>(paramCount + 1);
+    for (int i = 1; i <= paramCount; ++i) {
         const char* paramName = sqlite3_bind_parameter_name(stmt, i);
-        if (paramName && paramName[0] == ':') {
-            std::string name = paramName + 1; // ':' 제거
-            auto it = parameters.find(name);
-            if (it != parameters.end()) {
-                sqlite3_bind_text(stmt, i, it->second.c_str(), -1, SQLITE_TRANSIENT);
-            } else {
-                throw QueryExecutionException("Parameter :" + name + "is not set.");
-            }
+        if (paramName && (paramName[0] == ':' || paramName[0] == '@' || paramName[0] == '$')) {
+            (*resolved)[i] = paramName + 1; // 접두사 제거
         } else {
             throw QueryExecutionException("Unnamed parameters are not supported");
         }
     }
+    connection->setStatementAttachment(stmt, PARAMETER_NAMES_KEY, resolved);
+    return resolved;
 }
 
-void Query::finalizeStatement() {
-    std::lock_guard<std::mutex> lock(cacheMutex);
+std::shared_ptr<QueryCursor> Query::openCursor() {
+    // 연결이 소유한 캐시에서 Prepared Statement를 대여
+    auto stmt = static_cast<sqlite3_stmt*>(connection->acquireStatement(queryString));
+    // 이후 예외가 발생해도 커서가 문을 반납합니다.
+    auto cursor = std::make_shared<QueryCursor>(connection, stmt, queryString);
 
-    // Prepared Statement를 캐시에서 제거하지 않고 유지하여 재사용
-    stmt = nullptr;
-}
+    // 모든 파라미터를 복사 없이 바인딩하고, 값의 수명은 커서가 유지합니다.
+    auto names = getParameterNames(stmt);
+    for (size_t i = 1; i < names->size(); ++i) {
+        const std::string& name = (*names)[i];
+        auto it = parameters->find(name);
+        if (it == parameters->end()) {
+            throw QueryExecutionException("Parameter :" + name + " is not set.");
+        }
+        if (SQLiteConnection::bindValue(stmt, static_cast<int>(i), it->second) != SQLITE_OK) {
+            throw QueryExecutionException("Failed to bind parameter :" + name);
+        }
+    }
+    cursor->retainParameters(parameters);
 
-std::vector<std::shared_ptr<IEntity>> Query::list() {
-    prepareAndBind();
+    return cursor;
+}
 
-    // 결과 처리 (엔티티 매핑)
-    std::vector<std::shared_ptr<IEntity>> entities;
+std::shared_ptr<IQueryCursor> Query::stream() {
+    auto cursor = openCursor();
+    // 호출자가 들고 있는 커서가 세션이 반납한 연결을 계속 쓰지 않도록 세션에 알립니다.
+    if (fetchContext.trackCursor) {
+        fetchContext.trackCursor(cursor);
+    }
+    return cursor;
+}
 
-    // 테이블 이름 추출 및 매핑 정보 가져오기
-    std::string tableName = connection->extractTableName(queryString);
-    auto mappingInfo = EntityMapper::getInstance().getMappingByTableName(tableName);
-    if (!mappingInfo) {
-        throw MappingException("No mapping found for table: " + tableName);
-    }
-
-    int rc;
-    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
-        auto entity = mappingInfo->entityConstructor();
-        for (int i = 0; i < sqlite3_column_count(stmt); ++i) {
-            std::string columnName = sqlite3_column_name(stmt, i);
-            const unsigned char* text = sqlite3_column_text(stmt, i);
-            std::string value = text ? reinterpret_cast<const char*>(text) : "";
-
-            if (columnName == mappingInfo->idColumnName) {
-                entity->setId(value);
-            } else {
-                // 필드 매핑 찾아서 값 설정
-                for (const auto& field : mappingInfo->fields) {
-                    if (field.columnName == columnName) {
-                        entity->setFieldValue(field.fieldName, value);
-                        break;
-                    }
-                }
-            }
+std::vector<std::shared_ptr<IEntity>> Query::list() {
+    QueryResultCache& resultCache = QueryResultCache::getInstance();
+    std::string cacheKey = resultCacheKey("list");
+    if (!cacheKey.empty()) {
+        auto cached = resultCache.get(cacheKey);
+        // 매핑이 재등록되었으면 캐시된 계획을 사용하지 않습니다.
+        if (cached && EntityMapper::getInstance().getMappingByTypeId(cached->plan->mapping->typeId) == cached->plan->mapping) {
+            logger.debug("Query result served from cache. Rows: " + std::to_string(cached->rows->rowCount()));
+            return materialize(*cached->rows, *cached->plan);
         }
-        entities.push_back(entity);
     }
 
-    if (rc != SQLITE_DONE) {
-        std::string errorMessage = sqlite3_errmsg(connection->getNativeHandle());
-        sqlite3_finalize(stmt);
-        stmt = nullptr;
-        logger.error("Failed to execute query: " + errorMessage);
-        throw QueryExecutionException(errorMessage);
+    auto cursor = openCursor();
+
+    // 매핑 정보가 없으면 결과를 읽기 전에 실패
+    auto joined = joinFetches.empty() ? nullptr : createJoinedRows(cursor->getColumnNames());
+    auto plan = joined ? joined->getRootPlan() : cursor->getMappingPlan();
+
+    auto readTables = cacheKey.empty() ? nullptr : cursor->getReadTables();
+    if (readTables) {
+        // 실행 전의 버전을 기록해야 실행 중에 커밋된 변경도 무효화됩니다.
+        TableVersions versions = QueryResultCache::captureVersions(*readTables);
+        auto rows = std::make_shared<const ResultSet>(fetchAll(*cursor));
+        resultCache.put(cacheKey, std::move(versions), std::make_shared<const CachedQueryResult>(CachedQueryResult{rows, plan}));
+        logger.debug("Query executed successfully. Rows fetched: " + std::to_string(rows->rowCount()));
+        return materialize(*rows, *plan);
     }
 
-    sqlite3_finalize(stmt);
-    stmt = nullptr;
+    // 결과 처리 (엔티티 매핑). 관계는 결과 전체를 하나의 묶음으로 일괄 로딩합니다.
+    auto readValue = [&cursor](size_t column) { return cursor->getValue(column); };
+    std::vector<std::shared_ptr<IEntity>> entities;
+    if (joined) {
+        // 조인 관계는 같은 행에서 함께 만듭니다.
+        while (cursor->next()) {
+            entities.push_back(joined->read(readValue));
+        }
+        logger.debug("Query executed successfully. Rows fetched: " + std::to_string(entities.size()));
+        return entities;
+    }
+    auto group = createFetchGroup(plan->mapping, cursor->getColumnNames());
+    while (cursor->next()) {
+        entities.push_back(cursor->getEntity());
+        if (group) {
+            group->add(entities.back(), readValue);
+        }
+    }
 
     logger.debug("Query executed successfully. Rows fetched: " + std::to_string(entities.size()));
     return entities;
 }
 
+std::future<std::vector<std::shared_ptr<IEntity>>> Query::listAsync() {
+    // 파라미터 맵은 copy-on-write이므로 복사본은 이후의 setParameter에 영향을 받지 않습니다.
+    auto snapshot = std::make_shared<Query>(*this);
+    auto work = [snapshot]() { return snapshot->list(); };
+    if (asyncStrand) {
+        return asyncStrand->submit(work);
+    }
+    return AsyncExecutor::getInstance().submit(work);
+}
+
+void Query::setAsyncStrand(std::shared_ptr<AsyncStrand> strand) {
+    asyncStrand = std::move(strand);
+}
+
 std::shared_ptr<IEntity> Query::uniqueResult() {
-    auto results = list();
-    if (results.size() == 1) {
-        return results[0];
-    } else if (results.empty()) {
+    auto cursor = openCursor();
+    auto joined = joinFetches.empty() ? nullptr : createJoinedRows(cursor->getColumnNames());
+    auto plan = joined ? joined->getRootPlan() : cursor->getMappingPlan();
+
+    // 두 번째 행까지만 읽고 멈춥니다.
+    if (!cursor->next()) {
         return nullptr;
+    }
+    auto readValue = [&cursor](size_t column) { return cursor->getValue(column); };
+    std::shared_ptr<IEntity> entity;
+    if (joined) {
+        entity = joined->read(readValue);
     } else {
+        entity = cursor->getEntity();
+        if (auto group = createFetchGroup(plan->mapping, cursor->getColumnNames())) {
+            group->add(entity, readValue);
+        }
+    }
+    if (cursor->next()) {
         throw QueryExecutionException("Query returned more than one result.");
     }
+    return entity;
 }
 
-std::vector<std::map<std::string, std::string>> Query::listMap() {
-    prepareAndBind();
-
-    // 결과 처리 (맵으로 반환)
-    std::vector<std::map<std::string, std::string>> results;
-
-    int rc;
-    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
-        std::map<std::string, std::string> row;
-        for (int i = 0; i < sqlite3_column_count(stmt); ++i) {
-            std::string columnName = sqlite3_column_name(stmt, i);
-            const unsigned char* text = sqlite3_column_text(stmt, i);
-            std::string value = text ? reinterpret_cast<const char*>(text) : "";
-            row[columnName] = value;
+ResultSet Query::listMap() {
+    QueryResultCache& resultCache = QueryResultCache::getInstance();
+    std::string cacheKey = resultCacheKey("map");
+    if (!cacheKey.empty()) {
+        if (auto cached = resultCache.get(cacheKey)) {
+            logger.debug("Query result served from cache. Rows: " + std::to_string(cached->rows->rowCount()));
+            return *cached->rows;
         }
-        results.push_back(row);
     }
 
-    if (rc != SQLITE_DONE) {
-        std::string errorMessage = sqlite3_errmsg(connection->getNativeHandle());
-        sqlite3_finalize(stmt);
-        stmt = nullptr;
-        logger.error("Failed to execute query: " + errorMessage);
-        throw QueryExecutionException(errorMessage);
-    }
+    auto cursor = openCursor();
+    auto readTables = cacheKey.empty() ? nullptr : cursor->getReadTables();
+    TableVersions versions = readTables ? QueryResultCache::captureVersions(*readTables) : TableVersions();
 
-    sqlite3_finalize(stmt);
-    stmt = nullptr;
+    // 결과 처리 (ResultSet으로 반환)
+    ResultSet results = fetchAll(*cursor);
+    if (readTables) {
+        resultCache.put(cacheKey, std::move(versions),
+                        std::make_shared<const CachedQueryResult>(CachedQueryResult{std::make_shared<const ResultSet>(results), nullptr}));
+    }
 
-    logger.debug("Query executed successfully. Rows fetched: " + std::to_string(results.size()));
+    logger.debug("Query executed successfully. Rows fetched: " + std::to_string(results.rowCount()));
     return results;
-}
\ No newline at end of file
+}
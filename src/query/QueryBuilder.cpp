@@ -1,5 +1,7 @@
 #include "query/QueryBuilder.h"
 #include "query/Query.h"
+#include "ORMException/MappingException/MappingException.h"
+#include <algorithm>
 
 QueryBuilder::QueryBuilder(std::shared_ptr<IDatabaseConnection> connection)
     : connection(connection), logger(Logger::getInstance()) {
@@ -16,6 +18,8 @@ IQueryBuilder& QueryBuilder::select(const std::string& fields) {
 }
 
 IQueryBuilder& QueryBuilder::from(const std::string& table, const std::string& alias) {
+    fromTable = table;
+    fromAlias = alias;
     fromClause = "FROM " + table;
     if (!alias.empty()) {
         fromClause += " " + alias;
@@ -47,8 +51,87 @@ IQueryBuilder& QueryBuilder::offset(int offset) {
     return *this;
 }
 
+IQueryBuilder& QueryBuilder::fetchJoin(const std::string& relationName) {
+    if (std::find(fetchJoins.begin(), fetchJoins.end(), relationName) == fetchJoins.end()) {
+        fetchJoins.push_back(relationName);
+    }
+    return *this;
+}
+
+std::vector<JoinFetch> QueryBuilder::resolveFetchJoins(const EntityMapping& root, std::string& joinColumns,
+                                                       std::string& joinClauses) const {
+    const std::string& rootRef = fromAlias.empty() ? fromTable : fromAlias;
+    std::vector<JoinFetch> joins;
+    for (const auto& relationName : fetchJoins) {
+        auto relationship = std::find_if(root.relationships.begin(), root.relationships.end(),
+                                         [&](const Relationship& r) { return r.relationshipName == relationName; });
+        if (relationship == root.relationships.end()) {
+            throw MappingException("No relationship '" + relationName + "' on entity: " + root.entityName);
+        }
+        // 컬렉션 관계는 루트 행이 늘어나 LIMIT/OFFSET이 틀어지므로 지연 로딩을 사용합니다.
+        if (relationship->type != "ManyToOne" && relationship->type != "OneToOne") {
+            throw MappingException("fetchJoin supports only ManyToOne/OneToOne relationships: " + relationName);
+        }
+        auto target = EntityMapper::getInstance().getMapping(relationship->targetEntity);
+        if (!target) {
+            throw MappingException("No mapping found for related entity: " + relationship->targetEntity);
+        }
+
+        // 대상 테이블은 모든 컬럼에 "zj<n>__" 접두사를 붙인 서브쿼리로 조인합니다. 조인된 쪽에는 루트와 같은 이름의
+        // 컬럼이 없으므로 where/orderBy의 한정되지 않은 컬럼 이름은 항상 루트 테이블을 가리킵니다.
+        // (단순 서브쿼리이므로 SQLite가 평탄화해 대상 테이블의 인덱스를 그대로 사용합니다)
+        std::string alias = "zj" + std::to_string(joins.size());
+        std::string prefix = alias + "__";
+        std::vector<std::string> targetColumns;
+        targetColumns.push_back(target->idColumnName);
+        for (const auto& field : target->fields) {
+            targetColumns.push_back(field.columnName);
+        }
+        for (const auto& column : targetColumns) {
+            joinColumns += ", " + alias + "." + prefix + column;
+        }
+
+        bool owning = FetchGroup::ownsForeignKey(*relationship);
+        std::string keyColumn = owning ? target->idColumnName : FetchGroup::inverseJoinColumn(root, *relationship, *target);
+        std::vector<std::string> subqueryColumns = targetColumns;
+        if (std::find(subqueryColumns.begin(), subqueryColumns.end(), keyColumn) == subqueryColumns.end()) {
+            subqueryColumns.push_back(keyColumn);
+        }
+        std::string subquery;
+        for (const auto& column : subqueryColumns) {
+            subquery += (subquery.empty() ? "" : ", ") + column + " AS " + prefix + column;
+        }
+
+        joinClauses += " LEFT JOIN (SELECT " + subquery + " FROM " + target->tableName + ") " + alias + " ON " + alias +
+                       "." + prefix + keyColumn + " = " + rootRef + "." +
+                       (owning ? relationship->joinColumn : root.idColumnName);
+
+        joins.push_back(JoinFetch{static_cast<size_t>(relationship - root.relationships.begin()), target, prefix});
+    }
+    return joins;
+}
+
 std::shared_ptr<IQuery> QueryBuilder::getQuery() {
-    std::string queryString = selectClause + " " + fromClause;
+    std::shared_ptr<const EntityMapping> joinRoot;
+    std::vector<JoinFetch> joins;
+    std::string queryString;
+    if (fetchJoins.empty()) {
+        queryString = selectClause + " " + fromClause;
+    } else {
+        joinRoot = EntityMapper::getInstance().getMappingByTableName(fromTable);
+        if (!joinRoot) {
+            throw MappingException("No mapping found for table: " + fromTable);
+        }
+        std::string joinColumns;
+        std::string joinClauses;
+        joins = resolveFetchJoins(*joinRoot, joinColumns, joinClauses);
+        // SELECT *는 조인 테이블 컬럼까지 포함하므로 루트 테이블 컬럼으로 한정합니다.
+        std::string rootColumns = selectClause;
+        if (rootColumns.empty() || rootColumns == "SELECT *") {
+            rootColumns = "SELECT " + (fromAlias.empty() ? fromTable : fromAlias) + ".*";
+        }
+        queryString = rootColumns + joinColumns + " " + fromClause + joinClauses;
+    }
     if (!whereClause.empty()) {
         queryString += " " + whereClause;
     }
@@ -64,5 +147,19 @@ std::shared_ptr<IQuery> QueryBuilder::getQuery() {
 
     logger.debug("Generated query string: " + queryString);
 
-    return std::make_shared<Query>(connection, queryString);
+    auto query = std::make_shared<Query>(connection, queryString);
+    query->setAsyncStrand(asyncStrand);
+    query->setFetchContext(fetchContext);
+    if (!joins.empty()) {
+        query->setJoinFetches(std::move(joinRoot), std::move(joins));
+    }
+    return query;
+}
+
+void QueryBuilder::setFetchContext(FetchContext context) {
+    fetchContext = std::move(context);
+}
+
+void QueryBuilder::setAsyncStrand(std::shared_ptr<AsyncStrand> strand) {
+    asyncStrand = std::move(strand);
 }
\ No newline at end of file
@@ -0,0 +1,295 @@
+#include "query/QueryCursor.h"
+#include "database/SQLite/SQLiteConnection.h"
+#include "ORMException/DataAccessException/QueryExecutionException/QueryExecutionException.h"
+#include "ORMException/MappingException/MappingException.h"
+#include "ORMException/InvalidParameterException/InvalidParameterException.h"
+
+QueryCursor::QueryCursor(std::shared_ptr<IDatabaseConnection> connection, sqlite3_stmt* stmt, const std::string& queryString)
+    : connection(connection), stmt(stmt), queryString(queryString), logger(Logger::getInstance()),
+      hasRow(false), rowsFetched(0), invalidated(false) {
+    int count = sqlite3_column_count(stmt);
+    columnNames.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        columnNames.emplace_back(sqlite3_column_name(stmt, i));
+    }
+    logger.debug("QueryCursor opened: " + queryString);
+}
+
+QueryCursor::~QueryCursor() {
+    close();
+}
+
+bool QueryCursor::next() {
+    std::lock_guard<std::mutex> lock(cursorMutex);
+    if (invalidated) {
+        throw QueryExecutionException("Cursor was closed with its session.");
+    }
+    if (!stmt) {
+        return false;
+    }
+
+    // 같은 연결을 쓰는 다른 스레드와 겹치지 않도록 연결 잠금 아래에서 실행합니다.
+    bool row = false;
+    try {
+        row = connection->fetchRow(stmt);
+    } catch (...) {
+        releaseStatement();
+        throw;
+    }
+    if (row) {
+        hasRow = true;
+        ++rowsFetched;
+        return true;
+    }
+
+    // 결과를 모두 소비하면 즉시 문을 반납합니다.
+    releaseStatement();
+    return false;
+}
+
+void QueryCursor::retainParameters(std::shared_ptr<const void> values) {
+    boundValues = std::move(values);
+}
+
+void QueryCursor::close() {
+    std::lock_guard<std::mutex> lock(cursorMutex);
+    releaseStatement();
+}
+
+void QueryCursor::invalidate() {
+    std::lock_guard<std::mutex> lock(cursorMutex);
+    if (stmt) {
+        logger.warn("Closing a cursor left open when its session closed: " + queryString);
+    }
+    releaseStatement();
+    invalidated = true;
+}
+
+void QueryCursor::releaseStatement() {
+    if (stmt) {
+        connection->releaseStatement(stmt);
+        stmt = nullptr;
+        hasRow = false;
+        boundValues.reset();
+        logger.debug("QueryCursor closed. Rows fetched: " + std::to_string(rowsFetched));
+    }
+}
+
+const std::string QueryCursor::PLAN_ATTACHMENT_KEY = "QueryCursor.mappingPlan";
+
+std::shared_ptr<const MappingPlan> QueryCursor::getMappingPlan() {
+    if (plan) {
+        return plan;
+    }
+    if (!stmt) {
+        throw QueryExecutionException("Cursor is closed.");
+    }
+
+    // 같은 문이 이전에 실행되며 만든 계획이 있으면 재사용
+    plan = std::static_pointer_cast<const MappingPlan>(connection->getStatementAttachment(stmt, PLAN_ATTACHMENT_KEY));
+    if (plan && EntityMapper::getInstance().getMappingByTypeId(plan->mapping->typeId) != plan->mapping) {
+        // 매핑이 재등록되었으면 계획을 다시 만듭니다.
+        plan.reset();
+    }
+    if (!plan) {
+        plan = buildPlan();
+        connection->setStatementAttachment(stmt, PLAN_ATTACHMENT_KEY, std::const_pointer_cast<MappingPlan>(plan));
+    }
+    return plan;
+}
+
+std::shared_ptr<const MappingPlan> QueryCursor::buildPlan() {
+    int count = static_cast<int>(columnNames.size());
+
+    // 결과 컬럼의 원본 테이블로 엔티티를 결정합니다.
+    std::string tableName;
+#ifdef SQLITE_ENABLE_COLUMN_METADATA
+    for (int i = 0; i < count && tableName.empty(); ++i) {
+        const char* columnTable = sqlite3_column_table_name(stmt, i);
+        if (columnTable) {
+            tableName = columnTable;
+        }
+    }
+#endif
+    if (tableName.empty()) {
+        // 컬럼 메타데이터를 사용할 수 없으면 SQL에서 추출
+        tableName = connection->extractTableName(queryString);
+    }
+
+    auto mapping = EntityMapper::getInstance().getMappingByTableName(tableName);
+    if (!mapping) {
+        throw MappingException("No mapping found for table: " + tableName);
+    }
+
+    std::unordered_map<std::string, const FieldMapping*> fieldsByColumn;
+    for (const auto& field : mapping->fields) {
+        fieldsByColumn.emplace(field.columnName, &field);
+    }
+
+    auto newPlan = std::make_shared<MappingPlan>();
+    newPlan->columns.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        std::string columnName = columnNames[i];
+#ifdef SQLITE_ENABLE_COLUMN_METADATA
+        // 다른 테이블의 컬럼은 건너뛰고, 별칭이 붙은 컬럼은 원본 이름으로 매핑합니다.
+        const char* columnTable = sqlite3_column_table_name(stmt, i);
+        const char* originName = sqlite3_column_origin_name(stmt, i);
+        if (columnTable && tableName != columnTable) {
+            newPlan->columns.push_back({MappingPlan::Target::Skip, nullptr});
+            continue;
+        }
+        if (originName) {
+            columnName = originName;
+        }
+#endif
+        if (columnName == mapping->idColumnName) {
+            newPlan->columns.push_back({MappingPlan::Target::Id, nullptr});
+            continue;
+        }
+        auto it = fieldsByColumn.find(columnName);
+        if (it != fieldsByColumn.end()) {
+            newPlan->columns.push_back({MappingPlan::Target::Field, it->second});
+        } else {
+            newPlan->columns.push_back({MappingPlan::Target::Skip, nullptr});
+        }
+    }
+    newPlan->mapping = mapping;
+
+    logger.debug("Mapping plan built for table: " + tableName);
+    return newPlan;
+}
+
+std::shared_ptr<const EntityMapping> QueryCursor::getMapping() {
+    return getMappingPlan()->mapping;
+}
+
+std::shared_ptr<const std::vector<std::string>> QueryCursor::getReadTables() const {
+    if (!stmt) {
+        return nullptr;
+    }
+    return std::static_pointer_cast<const std::vector<std::string>>(
+        connection->getStatementAttachment(stmt, SQLiteConnection::READ_TABLES_KEY));
+}
+
+std::shared_ptr<IEntity> QueryCursor::getEntity() {
+    checkRow(0);
+    return getMappingPlan()->materialize([this](size_t column) { return getValue(column); });
+}
+
+size_t QueryCursor::columnCount() const {
+    return columnNames.size();
+}
+
+const std::string& QueryCursor::getColumnName(size_t column) const {
+    if (column >= columnNames.size()) {
+        throw InvalidParameterException("Column index out of range: " + std::to_string(column));
+    }
+    return columnNames[column];
+}
+
+int QueryCursor::findColumn(const std::string& name) const {
+    for (size_t i = 0; i < columnNames.size(); ++i) {
+        if (columnNames[i] == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+void QueryCursor::checkRow(size_t column) const {
+    if (!hasRow) {
+        throw QueryExecutionException("Cursor is not positioned on a row.");
+    }
+    if (column >= columnNames.size() && !columnNames.empty()) {
+        throw InvalidParameterException("Column index out of range: " + std::to_string(column));
+    }
+}
+
+ColumnType QueryCursor::getType(size_t column) const {
+    checkRow(column);
+    switch (sqlite3_column_type(stmt, static_cast<int>(column))) {
+        case SQLITE_INTEGER:
+            return ColumnType::Integer;
+        case SQLITE_FLOAT:
+            return ColumnType::Real;
+        case SQLITE_TEXT:
+            return ColumnType::Text;
+        case SQLITE_BLOB:
+            return ColumnType::Blob;
+        default:
+            return ColumnType::Null;
+    }
+}
+
+bool QueryCursor::isNull(size_t column) const {
+    return getType(column) == ColumnType::Null;
+}
+
+int64_t QueryCursor::getInt64(size_t column) const {
+    checkRow(column);
+    return sqlite3_column_int64(stmt, static_cast<int>(column));
+}
+
+double QueryCursor::getDouble(size_t column) const {
+    checkRow(column);
+    return sqlite3_column_double(stmt, static_cast<int>(column));
+}
+
+std::string_view QueryCursor::getText(size_t column) const {
+    checkRow(column);
+    int index = static_cast<int>(column);
+    const unsigned char* text = sqlite3_column_text(stmt, index);
+    if (!text) {
+        return std::string_view();
+    }
+    return std::string_view(reinterpret_cast<const char*>(text), sqlite3_column_bytes(stmt, index));
+}
+
+std::string QueryCursor::getString(size_t column) const {
+    return std::string(getText(column));
+}
+
+ColumnValue QueryCursor::getValue(size_t column) const {
+    checkRow(column);
+    int index = static_cast<int>(column);
+    ColumnValue value;
+    switch (sqlite3_column_type(stmt, index)) {
+        case SQLITE_INTEGER:
+            value.type = ColumnType::Integer;
+            value.integer = sqlite3_column_int64(stmt, index);
+            break;
+        case SQLITE_FLOAT:
+            value.type = ColumnType::Real;
+            value.real = sqlite3_column_double(stmt, index);
+            break;
+        case SQLITE_TEXT:
+            value.type = ColumnType::Text;
+            value.text = std::string_view(reinterpret_cast<const char*>(sqlite3_column_text(stmt, index)),
+                                          sqlite3_column_bytes(stmt, index));
+            break;
+        case SQLITE_BLOB: {
+            // 길이 0인 BLOB은 nullptr을 반환하므로 길이를 먼저 확인합니다.
+            const void* blob = sqlite3_column_blob(stmt, index);
+            int bytes = sqlite3_column_bytes(stmt, index);
+            value.type = ColumnType::Blob;
+            value.text = bytes > 0 ? std::string_view(static_cast<const char*>(blob), bytes) : std::string_view();
+            break;
+        }
+        default:
+            break;
+    }
+    return value;
+}
+
+void QueryCursor::appendRow(ResultSet& resultSet) const {
+    checkRow(0);
+    SQLiteConnection::appendRow(stmt, resultSet);
+}
+
+const std::vector<std::string>& QueryCursor::getColumnNames() const {
+    return columnNames;
+}
+
+ResultSet QueryCursor::createResultSet() const {
+    return ResultSet(columnNames);
+}
@@ -1,5 +1,10 @@
 #include "include/utils/ORMException/DataAccessException/LockAcquisitionException/LockAcqusitionException.h"
 
-LockAcquisitionException::LockAcquisitionException(const std::string& message)
-    : DataAccessException("LockAcquisitionException: " + message) {
+LockAcquisitionException::LockAcquisitionException(const std::string& message, size_t retryCount)
+    : DataAccessException("LockAcquisitionException: " + message + " (retries: " + std::to_string(retryCount) + ")"),
+      retryCount(retryCount) {
+}
+
+size_t LockAcquisitionException::getRetryCount() const {
+    return retryCount;
 }
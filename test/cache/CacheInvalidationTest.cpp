@@ -0,0 +1,101 @@
+// 쓰기 시 1차/2차 캐시 무효화 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "include/mapping/EntityReflection.h"
+#include "core/SessionFactory.h"
+#include "core/Session.h"
+#include "include/cache/CacheManager.h"
+#include "ORMException/MappingException/EntityNotFoundException/EntityNotFoundException.h"
+#include <cstdio>
+#include <iostream>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+class Item : public IEntity {
+public:
+    int64_t id = 0;
+    std::string name;
+    ZENIX_ENTITY(Item, id, name)
+};
+
+std::string nameIn(const std::shared_ptr<Session>& session, int id) {
+    return std::static_pointer_cast<Item>(session->find("Item", id))->name;
+}
+
+std::shared_ptr<Item> makeItem(int64_t id, const std::string& name) {
+    auto item = std::make_shared<Item>();
+    item->id = id;
+    item->name = name;
+    return item;
+}
+
+} // namespace
+
+int main() {
+    const char* database = "cache_invalidation_test.db";
+    std::remove(database);
+
+    EntityMapper::getInstance().registerEntity(EntityReflection::makeMapping<Item>("items"));
+    CacheManager::getInstance().clear();
+
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    SessionFactory::getInstance().configure(config);
+
+    auto writer = SessionFactory::getInstance().openSession();
+    writer->createQuery("CREATE TABLE items (id INTEGER PRIMARY KEY, name TEXT)")->listMap();
+    writer->createQuery("INSERT INTO items VALUES (1, 'v1'), (2, 'keep')")->listMap();
+
+    // 다른 세션의 find가 2차 캐시를 채운 뒤 update하면 해당 키가 무효화됩니다.
+    auto reader = SessionFactory::getInstance().openSession();
+    check(nameIn(reader, 1) == "v1", "initial read");
+    check(CacheManager::getInstance().get("Item:1") != nullptr, "find populates second-level cache");
+    writer->update(makeItem(1, "v2"));
+    check(CacheManager::getInstance().get("Item:1") == nullptr, "update invalidates second-level cache");
+    check(nameIn(writer, 1) == "v2", "writer's session cache holds the update");
+    check(nameIn(SessionFactory::getInstance().openSession(), 1) == "v2", "other session reads fresh row");
+
+    // 트랜잭션 중의 무효화는 커밋 후에 적용되어, 그 사이 다른 세션이 채운 이전 값도 제거됩니다.
+    auto tx = writer->beginTransaction();
+    writer->update(makeItem(1, "v3"));
+    check(nameIn(SessionFactory::getInstance().openSession(), 1) == "v2", "uncommitted change not visible");
+    check(CacheManager::getInstance().get("Item:1") != nullptr, "committed value cached during transaction");
+    tx->commit();
+    check(CacheManager::getInstance().get("Item:1") == nullptr, "invalidated at commit");
+    check(nameIn(SessionFactory::getInstance().openSession(), 1) == "v3", "committed change visible");
+
+    // 롤백하면 변경을 반영했던 1차 캐시 엔트리를 버리고 다시 읽습니다.
+    tx = writer->beginTransaction();
+    writer->update(makeItem(2, "discarded"));
+    check(nameIn(writer, 2) == "discarded", "uncommitted change in session cache");
+    tx->rollback();
+    check(nameIn(writer, 2) == "keep", "rollback drops session cache entry");
+
+    // 삭제된 엔티티는 어느 캐시에서도 찾을 수 없습니다.
+    check(nameIn(SessionFactory::getInstance().openSession(), 2) == "keep", "cached before remove");
+    writer->remove(makeItem(2, "keep"));
+    check(CacheManager::getInstance().get("Item:2") == nullptr, "remove invalidates second-level cache");
+    bool notFound = false;
+    try {
+        writer->find("Item", 2);
+    } catch (const EntityNotFoundException&) {
+        notFound = true;
+    }
+    check(notFound, "removed entity not served from session cache");
+
+    writer->close();
+    reader->close();
+    std::remove(database);
+    if (failures == 0) {
+        std::cout << "CacheInvalidationTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
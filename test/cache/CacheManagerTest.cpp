@@ -0,0 +1,101 @@
+// CacheManager 2차 캐시 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "include/mapping/EntityReflection.h"
+#include "include/cache/CacheManager.h"
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+class Item : public IEntity {
+public:
+    int64_t id = 0;
+    ZENIX_ENTITY(Item, id)
+};
+
+class Note : public IEntity {
+public:
+    int64_t id = 0;
+    ZENIX_ENTITY(Note, id)
+};
+
+std::string key(const std::string& entity, int id) {
+    return entity + ":" + std::to_string(id);
+}
+
+} // namespace
+
+int main() {
+    CacheManager& cache = CacheManager::getInstance();
+
+    // 샤드 하나, 한도 3: 가장 오래 사용되지 않은 엔트리부터 제거합니다.
+    CacheConfig bounded;
+    bounded.shardCount = 1;
+    bounded.maxEntries = 3;
+    cache.configure(bounded);
+    for (int i = 1; i <= 3; ++i) {
+        cache.put(key("Item", i), std::make_shared<Item>());
+    }
+    check(cache.get(key("Item", 1)) != nullptr, "cached entry");
+    cache.put(key("Item", 4), std::make_shared<Item>());
+    check(cache.size() == 3, "bounded size");
+    check(cache.get(key("Item", 2)) == nullptr, "least recently used evicted");
+    check(cache.get(key("Item", 1)) != nullptr && cache.get(key("Item", 4)) != nullptr, "recent entries kept");
+
+    // 같은 키를 다시 넣으면 갱신하고 크기는 늘지 않습니다.
+    auto replacement = std::make_shared<Item>();
+    cache.put(key("Item", 1), replacement);
+    check(cache.get(key("Item", 1)) == replacement && cache.size() == 3, "put replaces entry");
+
+    cache.remove(key("Item", 1));
+    check(cache.get(key("Item", 1)) == nullptr, "removed entry");
+    cache.clear();
+    check(cache.size() == 0, "cleared");
+
+    // 엔티티별 TTL이 기본 TTL보다 우선합니다.
+    CacheConfig expiring;
+    expiring.defaultTTL = std::chrono::milliseconds(0);
+    expiring.entityTTL["Note"] = std::chrono::milliseconds(20);
+    cache.configure(expiring);
+    cache.put(key("Item", 1), std::make_shared<Item>());
+    cache.put(key("Note", 1), std::make_shared<Note>());
+    check(cache.get(key("Note", 1)) != nullptr, "entry before expiry");
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    check(cache.get(key("Note", 1)) == nullptr, "expired entry");
+    check(cache.get(key("Item", 1)) != nullptr, "entry without TTL");
+
+    // 여러 스레드가 동시에 넣고 읽어도 전체 한도를 넘지 않습니다.
+    CacheConfig shared;
+    shared.shardCount = 8;
+    shared.maxEntries = 64;
+    cache.configure(shared);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&cache, t] {
+            for (int i = 0; i < 1000; ++i) {
+                cache.put(key("Item", t * 1000 + i), std::make_shared<Item>());
+                cache.get(key("Item", t * 1000 + i / 2));
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    check(cache.size() > 0 && cache.size() <= 64, "concurrent use stays bounded");
+
+    cache.configure(CacheConfig());
+    if (failures == 0) {
+        std::cout << "CacheManagerTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,94 @@
+// 쿼리 결과 캐시와 테이블 버전 무효화 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "core/SessionFactory.h"
+#include "core/Session.h"
+#include "include/cache/QueryResultCache.h"
+#include <sqlite3.h>
+#include <cstdio>
+#include <iostream>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+std::string cached(const std::shared_ptr<Session>& session, const std::string& sql) {
+    auto query = session->createQuery(sql);
+    query->setCacheable(true);
+    return query->listMap().getString(0, 0);
+}
+
+} // namespace
+
+int main() {
+    const char* database = "query_result_cache_test.db";
+    std::remove(database);
+    QueryResultCache::getInstance().clear();
+
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    SessionFactory::getInstance().configure(config);
+    auto session = SessionFactory::getInstance().openSession();
+    session->createQuery("CREATE TABLE k (id INTEGER PRIMARY KEY, v TEXT)")->listMap();
+    session->createQuery("INSERT INTO k VALUES (1, 'a'), (2, 'b')")->listMap();
+    session->createQuery("CREATE TABLE w (id TEXT PRIMARY KEY, v TEXT) WITHOUT ROWID")->listMap();
+    session->createQuery("INSERT INTO w VALUES ('x', '1')")->listMap();
+
+    const std::string countK = "SELECT count(*) FROM k";
+    const std::string valueW = "SELECT v FROM w WHERE id = 'x'";
+    check(cached(session, countK) == "2" && cached(session, valueW) == "1", "initial results");
+
+    // 라이브러리를 거치지 않은 변경은 훅이 보지 못하므로 캐시된 결과가 그대로 반환됩니다.
+    sqlite3* outside = nullptr;
+    sqlite3_open(database, &outside);
+    sqlite3_exec(outside, "INSERT INTO k VALUES (3, 'c')", nullptr, nullptr, nullptr);
+    sqlite3_close(outside);
+    check(cached(session, countK) == "2", "result served from cache");
+    check(cached(session, "SELECT  count(*)\n FROM k ;") == "2", "normalized SQL shares the entry");
+    check(session->createQuery(countK)->listMap().getString(0, 0) == "3", "non-cacheable query reads database");
+
+    // 바인딩 값이 다르면 다른 엔트리입니다.
+    auto byId = [&](int id) {
+        auto query = session->createQuery("SELECT v FROM k WHERE id = :id");
+        query->setCacheable(true);
+        query->setParameter("id", id);
+        return query->listMap().getString(0, 0);
+    };
+    check(byId(1) == "a" && byId(2) == "b", "parameters are part of the key");
+
+    // 라이브러리 연결을 통한 INSERT/UPDATE/DELETE는 읽은 테이블의 엔트리를 무효화합니다.
+    session->createQuery("INSERT INTO k VALUES (4, 'd')")->listMap();
+    check(cached(session, countK) == "4", "insert invalidates");
+    session->createQuery("UPDATE k SET v = 'z' WHERE id = 1")->listMap();
+    check(byId(1) == "z", "update invalidates");
+    session->createQuery("DELETE FROM k")->listMap();
+    check(cached(session, countK) == "0", "truncating delete invalidates");
+
+    // WITHOUT ROWID 테이블은 update hook이 호출되지 않아도 무효화됩니다.
+    session->createQuery("UPDATE w SET v = '2' WHERE id = 'x'")->listMap();
+    check(cached(session, valueW) == "2", "WITHOUT ROWID update invalidates");
+
+    // 트랜잭션 안의 변경은 커밋될 때 무효화됩니다.
+    auto tx = session->beginTransaction();
+    session->createQuery("INSERT INTO k VALUES (5, 'e')")->listMap();
+    tx->commit();
+    check(cached(session, countK) == "1", "committed transaction invalidates");
+
+    // DDL도 무효화합니다.
+    session->createQuery("DROP TABLE k")->listMap();
+    session->createQuery("CREATE TABLE k (id INTEGER PRIMARY KEY, v TEXT)")->listMap();
+    check(cached(session, countK) == "0", "drop table invalidates");
+
+    session->close();
+    std::remove(database);
+    if (failures == 0) {
+        std::cout << "QueryResultCacheTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+// ConnectionPool 크기 조절 및 연결 검증 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "connection/ConnectionPool.h"
+#include "ORMException/DataAccessException/DatabaseConnectionException/DatabaseConnectionException.h"
+#include <cstdio>
+#include <future>
+#include <iostream>
+#include <thread>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+using Clock = std::chrono::steady_clock;
+
+} // namespace
+
+int main() {
+    const char* database = "connection_pool_test.db";
+    std::remove(database);
+
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    config.setConnectionTimeout(std::chrono::milliseconds(100));
+    config.setIdleTimeout(std::chrono::milliseconds(30));
+
+    {
+        // 최소 크기만큼 미리 열고, 부족하면 최대 크기까지 늘립니다.
+        ConnectionPool pool(config, 1, 3);
+        ConnectionPoolStats stats = pool.getStats();
+        check(stats.totalConnections == 1 && stats.idleConnections == 1, "pre-opened minimum");
+        auto first = pool.acquireConnection();
+        auto second = pool.acquireConnection();
+        auto third = pool.acquireConnection();
+        stats = pool.getStats();
+        check(stats.totalConnections == 3 && stats.idleConnections == 0, "grew to maximum");
+
+        // 최대 크기에서는 연결 타임아웃까지 기다린 뒤 실패합니다.
+        auto start = Clock::now();
+        bool timedOut = false;
+        try {
+            pool.acquireConnection();
+        } catch (const DatabaseConnectionException&) {
+            timedOut = true;
+        }
+        check(timedOut && Clock::now() - start >= std::chrono::milliseconds(100), "acquire times out at maximum");
+        check(pool.getStats().totalConnections == 3, "timeout does not grow past maximum");
+
+        // 가장 최근에 반납된 연결을 먼저 재사용합니다.
+        pool.releaseConnection(first);
+        pool.releaseConnection(second);
+        pool.releaseConnection(third);
+        check(pool.getStats().idleConnections == 3, "all connections idle");
+        check(pool.acquireConnection() == third, "most recently released reused first");
+        pool.releaseConnection(third);
+
+        // 유휴 시간이 지난 연결은 최소 크기까지 정리됩니다.
+        std::this_thread::sleep_for(std::chrono::milliseconds(60));
+        auto survivor = pool.acquireConnection();
+        stats = pool.getStats();
+        check(stats.totalConnections == 1 && stats.idleConnections == 0, "idle connections reaped to minimum");
+
+        // 유휴 중에 사용할 수 없게 된 연결은 대여 시 버리고 새 연결을 엽니다.
+        pool.releaseConnection(survivor);
+        survivor->disconnect();
+        auto replacement = pool.acquireConnection();
+        check(replacement != survivor && replacement->isValid(), "invalid idle connection replaced");
+        check(pool.getStats().totalConnections == 1, "replacement keeps pool size");
+        pool.releaseConnection(replacement);
+    }
+
+    {
+        // 트랜잭션이 열린 채 반납된 연결은 닫고, 최대 크기에서 기다리던 스레드가 새 연결을 엽니다.
+        DatabaseConfig waiting = config;
+        waiting.setConnectionTimeout(std::chrono::milliseconds(2000));
+        ConnectionPool pool(waiting, 1, 1);
+        auto held = pool.acquireConnection();
+        auto waiter = std::async(std::launch::async, [&pool] { return pool.acquireConnection(); });
+        while (pool.getStats().waitingThreads == 0) {
+            std::this_thread::yield();
+        }
+        held->executeUpdate("BEGIN");
+        pool.releaseConnection(held);
+        auto acquired = waiter.get();
+        check(acquired != held && acquired->isValid(), "waiter receives a fresh connection");
+        check(pool.getStats().totalConnections == 1, "discarded connection frees its slot");
+        pool.releaseConnection(acquired);
+    }
+
+    std::remove(database);
+    if (failures == 0) {
+        std::cout << "ConnectionPoolTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
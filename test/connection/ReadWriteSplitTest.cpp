@@ -0,0 +1,91 @@
+// ReadWriteSplit 연결 풀 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "core/SessionFactory.h"
+#include "core/Session.h"
+#include <sqlite3.h>
+#include <cstdio>
+#include <iostream>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+bool rejectsWrite(const std::shared_ptr<Session>& session) {
+    try {
+        session->createQuery("INSERT INTO t VALUES (NULL)")->listMap();
+    } catch (const std::exception&) {
+        return true;
+    }
+    return false;
+}
+
+void removeDatabase(const std::string& database) {
+    for (const char* suffix : {"", "-wal", "-shm"}) {
+        std::remove((database + suffix).c_str());
+    }
+}
+
+int64_t count(const std::shared_ptr<Session>& session) {
+    return session->createQuery("SELECT COUNT(*) FROM t")->listMap().getInt64(0, 0);
+}
+
+} // namespace
+
+int main() {
+    const char* database = "read_write_split_test.db";
+    removeDatabase(database);
+
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    config.setPoolMode(PoolMode::ReadWriteSplit);
+    config.setReaderCount(2);
+    SessionFactory::getInstance().configure(config);
+
+    // 쓰기 연결은 WAL 모드로 파일을 만들고, 읽기 연결은 읽기 전용으로 열립니다.
+    auto writer = SessionFactory::getInstance().openSession();
+    writer->createQuery("CREATE TABLE t (id INTEGER PRIMARY KEY)")->listMap();
+    check(writer->createQuery("PRAGMA journal_mode")->listMap().getString(0, 0) == "wal", "writer uses WAL");
+    auto readConnection = SessionFactory::getInstance().getReadConnection();
+    check(sqlite3_db_readonly(static_cast<sqlite3*>(readConnection->getNativeHandle()), "main") == 1,
+          "reader opened read-only");
+    SessionFactory::getInstance().releaseReadConnection(readConnection);
+
+    // 읽기 세션은 쓰기를 거부하고, 쓰기 세션이 열려 있어도 커밋된 데이터를 동시에 읽습니다.
+    writer->createQuery("INSERT INTO t VALUES (1)")->listMap();
+    auto reader1 = SessionFactory::getInstance().openSession(true);
+    auto reader2 = SessionFactory::getInstance().openSession(true);
+    check(rejectsWrite(reader1), "read session rejects writes");
+    check(count(reader1) == 1 && count(reader2) == 1, "readers see committed rows");
+
+    // 쓰기 트랜잭션이 진행 중이어도 읽기 세션은 커밋 전 상태를 읽습니다.
+    auto tx = writer->beginTransaction();
+    writer->createQuery("INSERT INTO t VALUES (2)")->listMap();
+    check(count(reader1) == 1, "reader does not see uncommitted rows");
+    tx->commit();
+    check(count(reader2) == 2, "reader sees rows after commit");
+    reader1->close();
+    reader2->close();
+
+    // 쓰기 세션의 읽기 전용 트랜잭션은 읽기 연결에서 실행되고, 끝나면 쓰기 연결로 돌아옵니다.
+    TransactionDefinition readOnly;
+    readOnly.readOnly = true;
+    auto readTx = writer->beginTransaction(readOnly);
+    check(count(writer) == 2, "read-only transaction reads");
+    check(rejectsWrite(writer), "read-only transaction runs on a reader");
+    readTx->commit();
+    check(!rejectsWrite(writer) && count(writer) == 3, "session connection restored after read-only transaction");
+
+    writer->close();
+    removeDatabase(database);
+    if (failures == 0) {
+        std::cout << "ReadWriteSplitTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
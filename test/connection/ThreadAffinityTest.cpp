@@ -0,0 +1,82 @@
+// 스레드 고정 연결 임대 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "core/SessionFactory.h"
+#include "core/Session.h"
+#include <cstdio>
+#include <iostream>
+#include <thread>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+// 다른 스레드에서 연결을 빌리고 반납한 뒤 스레드를 종료합니다. 빌리지 못하면 nullptr를 반환합니다.
+void* borrowOnThread() {
+    void* handle = nullptr;
+    std::thread([&handle] {
+        try {
+            auto connection = SessionFactory::getInstance().getConnection();
+            handle = connection->getNativeHandle();
+            SessionFactory::getInstance().releaseConnection(connection);
+        } catch (const std::exception&) {
+            handle = nullptr;
+        }
+    }).join();
+    return handle;
+}
+
+} // namespace
+
+int main() {
+    const char* database = "thread_affinity_test.db";
+    std::remove(database);
+
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    config.setMinPoolSize(1);
+    config.setMaxPoolSize(2);
+    config.setConnectionTimeout(std::chrono::milliseconds(200));
+    config.setThreadAffinity(true);
+    SessionFactory::getInstance().configure(config);
+    SessionFactory& factory = SessionFactory::getInstance();
+
+    // 같은 스레드는 반납 후에도 같은 연결을 다시 받습니다.
+    auto connection = factory.getConnection();
+    void* leased = connection->getNativeHandle();
+    factory.releaseConnection(connection);
+    connection = factory.getConnection();
+    check(connection->getNativeHandle() == leased, "thread reuses its leased connection");
+
+    // 임대 연결을 사용 중이면 같은 스레드의 다른 요청은 풀에서 빌립니다.
+    auto nested = factory.getConnection();
+    check(nested->getNativeHandle() != leased, "nested use borrows from the pool");
+    factory.releaseConnection(nested);
+    factory.releaseConnection(connection);
+
+    // 종료한 스레드의 임대는 풀로 돌아가므로, 최대 크기 2에서도 스레드가 차례로 연결을 빌릴 수 있습니다.
+    void* first = borrowOnThread();
+    void* second = borrowOnThread();
+    check(first != nullptr && first != leased, "other thread gets its own connection");
+    check(second != nullptr, "lease returned when its thread exits");
+
+    // 소유 스레드가 종료될 때 사용 중이던 임대는 마지막 사용이 끝난 뒤 반납됩니다.
+    std::shared_ptr<Session> handedOver;
+    std::thread([&handedOver] { handedOver = SessionFactory::getInstance().openSession(); }).join();
+    handedOver->createQuery("SELECT 1")->listMap();
+    check(borrowOnThread() == nullptr, "lease in use is not returned early");
+    handedOver->close();
+    check(borrowOnThread() != nullptr, "lease returned after last use");
+
+    std::remove(database);
+    if (failures == 0) {
+        std::cout << "ThreadAffinityTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
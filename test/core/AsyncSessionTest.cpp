@@ -0,0 +1,139 @@
+// AsyncExecutor 및 비동기 세션 API 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "include/mapping/EntityReflection.h"
+#include "core/SessionFactory.h"
+#include "core/Session.h"
+#include <atomic>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+class Item : public IEntity {
+public:
+    int64_t id = 0;
+    std::string name;
+    ZENIX_ENTITY(Item, id, name)
+};
+
+std::shared_ptr<Item> makeItem(int64_t id, const std::string& name) {
+    auto item = std::make_shared<Item>();
+    item->id = id;
+    item->name = name;
+    return item;
+}
+
+} // namespace
+
+int main() {
+    const char* database = "async_session_test.db";
+    std::remove(database);
+
+    EntityMapper::getInstance().registerEntity(EntityReflection::makeMapping<Item>("items"));
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    config.setMaxPoolSize(4);
+    SessionFactory::getInstance().configure(config);
+    AsyncExecutor& executor = AsyncExecutor::getInstance();
+
+    // 작업은 호출 스레드가 아닌 작업자에서 실행되고, 예외는 future로 전달됩니다.
+    auto caller = std::this_thread::get_id();
+    check(executor.submit([] { return std::this_thread::get_id(); }).get() != caller, "runs on a worker");
+    bool propagated = false;
+    try {
+        executor.submit([]() -> int { throw std::runtime_error("task failed"); }).get();
+    } catch (const std::runtime_error&) {
+        propagated = true;
+    }
+    check(propagated, "exception propagated through future");
+
+    // 직렬 실행기는 제출 순서대로 한 번에 하나씩 실행합니다.
+    auto strand = std::make_shared<AsyncStrand>(8);
+    std::vector<int> order;
+    std::atomic<int> running{0};
+    std::atomic<bool> overlapped{false};
+    for (int i = 0; i < 100; ++i) {
+        strand->post([&, i] {
+            if (++running > 1) {
+                overlapped = true;
+            }
+            order.push_back(i);
+            --running;
+        });
+    }
+    strand->waitIdle();
+    bool ordered = order.size() == 100;
+    for (size_t i = 0; ordered && i < order.size(); ++i) {
+        ordered = order[i] == static_cast<int>(i);
+    }
+    check(ordered && !overlapped, "strand preserves order without overlap");
+
+    // 세션의 비동기 작업은 제출 순서대로 실행됩니다.
+    auto session = SessionFactory::getInstance().openSession();
+    session->createQuery("CREATE TABLE items (id INTEGER PRIMARY KEY, name TEXT)")->listMap();
+    session->createQuery("INSERT INTO items VALUES (1, 'v0')")->listMap();
+    for (int i = 1; i <= 20; ++i) {
+        session->updateAsync(makeItem(1, "v" + std::to_string(i)));
+    }
+    auto found = session->findAsync("Item", 1).get();
+    check(std::static_pointer_cast<Item>(found)->name == "v20", "find sees preceding async updates");
+
+    auto listed = session->createQuery("SELECT * FROM items")->listAsync().get();
+    check(listed.size() == 1, "query listAsync");
+
+    // 실패한 작업의 예외는 해당 future로만 전달되고 이후 작업은 계속 실행됩니다.
+    auto missing = session->findAsync("Item", 99);
+    auto next = session->updateAsync(makeItem(1, "after"));
+    bool notFound = false;
+    try {
+        missing.get();
+    } catch (const std::exception&) {
+        notFound = true;
+    }
+    next.get();
+    check(notFound, "failed async operation reports its error");
+
+    // close는 대기 중인 비동기 작업이 끝난 뒤 연결을 반납합니다.
+    for (int i = 0; i < 50; ++i) {
+        session->saveAsync(makeItem(0, "bulk"));
+    }
+    session->close();
+    auto reader = SessionFactory::getInstance().openSession();
+    check(reader->createQuery("SELECT COUNT(*) FROM items WHERE name = 'bulk'")->listMap().getInt64(0, 0) == 50,
+          "close waits for pending async work");
+    reader->close();
+
+    // 대기열이 가득 차면 제출하는 스레드가 자리가 날 때까지 기다립니다.
+    executor.configure(1, 1);
+    std::promise<void> gate;
+    auto opened = gate.get_future().share();
+    executor.post([opened] { opened.wait(); }); // 작업자 점유
+    executor.post([] {});                        // 대기열 가득 참
+    std::atomic<bool> posted{false};
+    std::thread producer([&] {
+        executor.post([] {});
+        posted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    check(!posted, "post blocks while queue is full");
+    gate.set_value();
+    producer.join();
+    check(posted, "post resumes when queue drains");
+    executor.configure(4, 64);
+
+    std::remove(database);
+    if (failures == 0) {
+        std::cout << "AsyncSessionTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,119 @@
+// Session::saveAll/updateAll/removeAll 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "include/mapping/EntityReflection.h"
+#include "core/SessionFactory.h"
+#include "core/Session.h"
+#include <sqlite3.h>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+class Item : public IEntity {
+public:
+    int64_t id = 0;
+    std::string name;
+    int64_t qty = 0;
+    ZENIX_ENTITY(Item, id, name, qty)
+};
+
+// 실행된 문의 종류별 횟수
+size_t inserts = 0;
+size_t deletes = 0;
+
+int countStatements(unsigned, void*, void* statement, void*) {
+    const char* sql = sqlite3_sql(static_cast<sqlite3_stmt*>(statement));
+    if (std::strncmp(sql, "INSERT", 6) == 0) {
+        ++inserts;
+    } else if (std::strncmp(sql, "DELETE", 6) == 0) {
+        ++deletes;
+    }
+    return 0;
+}
+
+int64_t count(const std::shared_ptr<Session>& session, const std::string& where = "1") {
+    return session->createQuery("SELECT COUNT(*) FROM items WHERE " + where)->listMap().getInt64(0, 0);
+}
+
+} // namespace
+
+int main() {
+    const char* database = "batch_write_test.db";
+    std::remove(database);
+
+    EntityMapper::getInstance().registerEntity(EntityReflection::makeMapping<Item>("items"));
+
+    // 연결 하나로 고정하고 파라미터 한도를 낮춰 청크 분할을 확인합니다.
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    config.setMinPoolSize(1);
+    config.setMaxPoolSize(1);
+    SessionFactory::getInstance().configure(config);
+    auto connection = SessionFactory::getInstance().getConnection();
+    auto db = static_cast<sqlite3*>(connection->getNativeHandle());
+    sqlite3_limit(db, SQLITE_LIMIT_VARIABLE_NUMBER, 5);
+    sqlite3_trace_v2(db, SQLITE_TRACE_STMT, &countStatements, nullptr);
+    check(connection->getMaxParameterCount() == 5, "lowered parameter limit");
+    SessionFactory::getInstance().releaseConnection(connection);
+
+    auto session = SessionFactory::getInstance().openSession();
+    session->createQuery("CREATE TABLE items (id INTEGER PRIMARY KEY, name TEXT UNIQUE, qty INTEGER)")->listMap();
+
+    // 컬럼 2개 x 한도 5 -> 문장당 2행
+    std::vector<std::shared_ptr<IEntity>> items;
+    for (int i = 0; i < 7; ++i) {
+        auto item = std::make_shared<Item>();
+        item->name = "item" + std::to_string(i);
+        item->qty = i;
+        items.push_back(item);
+    }
+    inserts = 0;
+    session->saveAll(items);
+    check(count(session) == 7, "all rows inserted");
+    check(inserts == 4, "insert split into chunks within the parameter limit");
+
+    // 한 청크가 실패하면 배치 전체가 롤백됩니다.
+    std::vector<std::shared_ptr<IEntity>> conflicting;
+    for (int i = 0; i < 5; ++i) {
+        auto item = std::make_shared<Item>();
+        item->name = i == 4 ? "item0" : "new" + std::to_string(i); // 마지막 청크가 UNIQUE 위반
+        conflicting.push_back(item);
+    }
+    bool failed = false;
+    try {
+        session->saveAll(conflicting);
+    } catch (const std::exception&) {
+        failed = true;
+    }
+    check(failed && count(session) == 7, "failed batch rolled back");
+
+    // 쿼리로 읽은 엔티티를 일괄 수정/삭제
+    auto loaded = session->createQuery("SELECT * FROM items ORDER BY id")->list();
+    for (auto& entity : loaded) {
+        std::static_pointer_cast<Item>(entity)->qty += 100;
+    }
+    session->updateAll(loaded);
+    check(count(session, "qty >= 100") == 7, "all rows updated");
+
+    deletes = 0;
+    session->removeAll(loaded);
+    check(count(session) == 0, "all rows removed");
+    check(deletes == 2, "delete split into chunks of IDs");
+
+    session->close();
+    std::remove(database);
+    if (failures == 0) {
+        std::cout << "BatchWriteTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
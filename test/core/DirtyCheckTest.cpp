@@ -0,0 +1,141 @@
+// 변경 감지와 부분 UPDATE 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "include/mapping/EntityReflection.h"
+#include "core/SessionFactory.h"
+#include "core/Session.h"
+#include "include/cache/CacheManager.h"
+#include <sqlite3.h>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+class Item : public IEntity {
+public:
+    int64_t id = 0;
+    std::string name;
+    int64_t qty = 0;
+    double price = 0.0;
+    ZENIX_ENTITY(Item, id, name, qty, price)
+};
+
+// 실행된 UPDATE 문
+std::vector<std::string> updates;
+
+int recordUpdates(unsigned, void*, void* statement, void*) {
+    const char* sql = sqlite3_sql(static_cast<sqlite3_stmt*>(statement));
+    if (std::strncmp(sql, "UPDATE", 6) == 0) {
+        updates.emplace_back(sql);
+    }
+    return 0;
+}
+
+std::shared_ptr<Item> load(const std::shared_ptr<Session>& session, int id) {
+    return std::static_pointer_cast<Item>(session->find("Item", id));
+}
+
+std::string row(const std::shared_ptr<Session>& session, int id) {
+    ResultSet rows = session->createQuery("SELECT name, qty, price FROM items WHERE id = " + std::to_string(id))->listMap();
+    return rows.getString(0, 0) + "|" + rows.getString(0, 1) + "|" + rows.getString(0, 2);
+}
+
+} // namespace
+
+int main() {
+    const char* database = "dirty_check_test.db";
+    std::remove(database);
+
+    EntityMapper::getInstance().registerEntity(EntityReflection::makeMapping<Item>("items"));
+    CacheManager::getInstance().clear();
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    config.setMinPoolSize(1);
+    config.setMaxPoolSize(2);
+    SessionFactory::getInstance().configure(config);
+    auto connection = SessionFactory::getInstance().getConnection();
+    sqlite3_trace_v2(static_cast<sqlite3*>(connection->getNativeHandle()), SQLITE_TRACE_STMT, &recordUpdates, nullptr);
+    SessionFactory::getInstance().releaseConnection(connection);
+
+    auto session = SessionFactory::getInstance().openSession();
+    session->createQuery("CREATE TABLE items (id INTEGER PRIMARY KEY, name TEXT, qty INTEGER, price REAL)")->listMap();
+    session->createQuery("INSERT INTO items VALUES (1, 'pen', 1, 1.5), (2, 'ink', 2, 3.0)")->listMap();
+
+    // 불러온 엔티티는 바뀐 컬럼만 씁니다.
+    auto pen = load(session, 1);
+    pen->qty = 5;
+    updates.clear();
+    session->update(pen);
+    check(updates.size() == 1 && updates[0] == "UPDATE items SET qty = ? WHERE id = ?;", "only changed column written");
+
+    // 바뀐 것이 없으면 문을 실행하지 않습니다. (쓰기 후 스냅샷 갱신)
+    updates.clear();
+    session->update(pen);
+    check(updates.empty(), "unchanged entity skipped");
+
+    // 그 사이 다른 세션이 바꾼 컬럼은 덮어쓰지 않습니다.
+    auto other = SessionFactory::getInstance().openSession();
+    other->createQuery("UPDATE items SET name = 'marker' WHERE id = 1")->listMap();
+    pen->price = 2.0;
+    session->update(pen);
+    check(row(other, 1) == "marker|5|2.0", "concurrent change to other column preserved");
+
+    // 바뀐 컬럼만 선언 순서대로 쓰고, 모두 바뀌면 등록 시 만든 전체 UPDATE를 씁니다.
+    pen->qty = 6;
+    pen->price = 2.5;
+    updates.clear();
+    session->update(pen);
+    check(updates.size() == 1 && updates[0] == "UPDATE items SET qty = ?, price = ? WHERE id = ?;", "two changed columns");
+    pen->name = "pencil";
+    pen->qty = 7;
+    pen->price = 3.0;
+    updates.clear();
+    session->update(pen);
+    check(updates.size() == 1 && updates[0] == "UPDATE items SET name = ?, qty = ?, price = ? WHERE id = ?;",
+          "all columns changed");
+
+    // 세션이 상태를 모르는 인스턴스는 모든 컬럼을 씁니다.
+    auto detached = std::make_shared<Item>();
+    detached->id = 2;
+    detached->name = "ink";
+    detached->qty = 9;
+    detached->price = 3.0;
+    updates.clear();
+    session->update(detached);
+    check(updates.size() == 1 && updates[0] == "UPDATE items SET name = ?, qty = ?, price = ? WHERE id = ?;",
+          "unknown instance writes all columns");
+
+    // 롤백하면 스냅샷을 버리므로, 되돌아간 값으로 다시 바꿔도 문을 실행합니다.
+    auto tx = session->beginTransaction();
+    pen->qty = 100;
+    session->update(pen);
+    tx->rollback();
+    pen->qty = 7;
+    updates.clear();
+    session->update(pen);
+    check(updates.size() == 1, "snapshot dropped on rollback");
+    check(row(other, 1) == "pencil|7|3.0", "row after rollback");
+
+    // updateAll도 변경 감지를 사용합니다.
+    pen->price = 4.0;
+    updates.clear();
+    session->updateAll({pen, load(session, 2)});
+    check(updates.size() == 1 && updates[0] == "UPDATE items SET price = ? WHERE id = ?;", "updateAll skips unchanged");
+
+    other->close();
+    session->close();
+    std::remove(database);
+    if (failures == 0) {
+        std::cout << "DirtyCheckTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,117 @@
+// GroupCommitWriter 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "core/GroupCommitWriter.h"
+#include "database/DatabaseConnectionFactory.h"
+#include <sqlite3.h>
+#include <atomic>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+std::atomic<int> commits{0};
+
+int countCommit(void*) {
+    ++commits;
+    return 0;
+}
+
+GroupCommitWriter::Operation insert(const std::string& name) {
+    return [name](IDatabaseConnection& writer) {
+        return writer.executeUpdate("INSERT INTO t (name) VALUES (?)", {SQLParameter(name)});
+    };
+}
+
+int64_t count(const std::shared_ptr<IDatabaseConnection>& connection, const std::string& where = "1") {
+    return connection->executeQuery("SELECT COUNT(*) FROM t WHERE " + where).getInt64(0, 0);
+}
+
+} // namespace
+
+int main() {
+    const char* database = "group_commit_test.db";
+    std::remove(database);
+
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    auto observer = DatabaseConnectionFactory::createConnection(config);
+    observer->connect();
+    observer->executeUpdate("CREATE TABLE t (id INTEGER PRIMARY KEY, name TEXT UNIQUE)");
+
+    {
+        GroupCommitWriter writer(config, 4, std::chrono::milliseconds(10000));
+        // 쓰기 스레드의 연결에 커밋 훅을 설치합니다.
+        writer.submit([](IDatabaseConnection& connection) {
+            sqlite3_commit_hook(static_cast<sqlite3*>(connection.getNativeHandle()), &countCommit, nullptr);
+            return 0;
+        });
+
+        // 배치가 가득 차면 지연을 기다리지 않고 한 트랜잭션으로 커밋합니다.
+        std::vector<std::future<int>> results;
+        for (int i = 0; i < 3; ++i) {
+            results.push_back(writer.submit(insert("row" + std::to_string(i))));
+        }
+        for (auto& result : results) {
+            check(result.get() == 1, "operation result");
+        }
+        check(commits == 1, "full batch committed once");
+
+        // 결과는 커밋 이후에 전달되므로 다른 연결에서 바로 보입니다.
+        check(count(observer) == 3, "rows visible when future completes");
+
+        // 한 작업이 실패하면 그 작업의 변경만 되돌리고 같은 배치의 나머지는 커밋합니다.
+        auto before = writer.submit(insert("before"));
+        auto failing = writer.submit([](IDatabaseConnection& connection) -> int {
+            connection.executeUpdate("INSERT INTO t (name) VALUES ('partial')");
+            throw std::runtime_error("operation failed");
+        });
+        auto duplicate = writer.submit(insert("row0"));
+        auto after = writer.submit(insert("after"));
+        check(before.get() == 1 && after.get() == 1, "neighbours of failed operations committed");
+        bool failed = false;
+        try {
+            failing.get();
+        } catch (const std::runtime_error&) {
+            failed = true;
+        }
+        check(failed, "failure reported to its caller");
+        failed = false;
+        try {
+            duplicate.get();
+        } catch (const std::exception&) {
+            failed = true;
+        }
+        check(failed, "constraint violation reported to its caller");
+        check(count(observer, "name = 'partial'") == 0, "failed operation rolled back");
+        check(count(observer) == 5 && commits == 2, "batch with failures committed once");
+    }
+
+    {
+        // 배치가 차지 않으면 첫 작업 이후 maxDelay가 지나 커밋합니다.
+        GroupCommitWriter writer(config, 64, std::chrono::milliseconds(50));
+        auto start = std::chrono::steady_clock::now();
+        writer.submit(insert("delayed")).get();
+        check(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(40), "partial batch waits maxDelay");
+
+        // 종료 시 남은 작업을 커밋합니다.
+        writer.submit(insert("pending"));
+    }
+    check(count(observer, "name = 'pending'") == 1, "pending operation committed on shutdown");
+
+    observer->disconnect();
+    std::remove(database);
+    if (failures == 0) {
+        std::cout << "GroupCommitTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,165 @@
+// 잠금 경합 재시도 및 백오프 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "core/SessionFactory.h"
+#include "core/Session.h"
+#include "ORMException/DataAccessException/LockAcquisitionException/LockAcqusitionException.h"
+#include <sqlite3.h>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+// 라이브러리 밖의 연결로 쓰기 잠금을 잡습니다.
+class ExternalLock {
+public:
+    ExternalLock(const char* database, const char* begin) {
+        sqlite3_open(database, &db);
+        sqlite3_exec(db, begin, nullptr, nullptr, nullptr);
+    }
+    ~ExternalLock() {
+        release();
+        sqlite3_close(db);
+    }
+    void release() {
+        sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr);
+    }
+
+private:
+    sqlite3* db = nullptr;
+};
+
+RetryPolicy fastRetry(size_t maxAttempts) {
+    RetryPolicy policy;
+    policy.maxAttempts = maxAttempts;
+    policy.initialBackoff = std::chrono::milliseconds(5);
+    policy.maxBackoff = std::chrono::milliseconds(20);
+    return policy;
+}
+
+} // namespace
+
+int main() {
+    const char* database = "lock_retry_test.db";
+    std::remove(database);
+
+    // 백오프는 지수적으로 늘고 최대값에서 멈추며, 지터는 [1 - jitter, 1] 비율만큼 줄입니다.
+    RetryPolicy exact;
+    exact.initialBackoff = std::chrono::milliseconds(10);
+    exact.maxBackoff = std::chrono::milliseconds(50);
+    exact.jitter = 0.0;
+    check(exact.backoff(1) == std::chrono::milliseconds(10) && exact.backoff(3) == std::chrono::milliseconds(40),
+          "exponential backoff");
+    check(exact.backoff(10) == std::chrono::milliseconds(50), "backoff capped");
+    RetryPolicy jittered = exact;
+    jittered.jitter = 0.5;
+    bool withinRange = true;
+    for (int i = 0; i < 100; ++i) {
+        auto delay = jittered.backoff(2);
+        withinRange = withinRange && delay >= std::chrono::milliseconds(10) && delay <= std::chrono::milliseconds(20);
+    }
+    check(withinRange, "jitter range");
+
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    config.setRetryPolicy(fastRetry(3));
+    SessionFactory::getInstance().configure(config);
+    auto session = SessionFactory::getInstance().openSession();
+    session->createQuery("CREATE TABLE t (id INTEGER PRIMARY KEY)")->listMap();
+
+    // 문 단위 재시도: 한도를 넘으면 재시도 횟수와 함께 실패합니다.
+    {
+        ExternalLock lock(database, "BEGIN EXCLUSIVE");
+        size_t retries = 0;
+        try {
+            session->createQuery("INSERT INTO t VALUES (NULL)")->listMap();
+        } catch (const LockAcquisitionException& e) {
+            retries = e.getRetryCount();
+        }
+        check(retries == 2, "statement retried up to the policy");
+    }
+
+    // 재시도 중 잠금이 풀리면 성공합니다.
+    {
+        ExternalLock lock(database, "BEGIN EXCLUSIVE");
+        std::thread releaser([&lock] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(30));
+            lock.release();
+        });
+        bool succeeded = true;
+        try {
+            session->inTransaction([](ISession& current) {
+                current.createQuery("INSERT INTO t VALUES (NULL)")->listMap();
+            }, fastRetry(20));
+        } catch (const LockAcquisitionException&) {
+            succeeded = false;
+        }
+        releaser.join();
+        check(succeeded, "transaction succeeds after lock released");
+    }
+
+    // 트랜잭션 재시도는 작업 전체를 다시 실행합니다. 문 단위 재시도를 끄고 횟수를 셉니다.
+    config.setRetryPolicy(RetryPolicy::none());
+    SessionFactory::getInstance().configure(config);
+    session->close();
+    session = SessionFactory::getInstance().openSession();
+    {
+        ExternalLock lock(database, "BEGIN IMMEDIATE");
+        size_t runs = 0;
+        size_t retries = 0;
+        try {
+            session->inTransaction([&runs](ISession& current) {
+                ++runs;
+                current.createQuery("INSERT INTO t VALUES (NULL)")->listMap();
+            }, fastRetry(3));
+        } catch (const LockAcquisitionException& e) {
+            retries = e.getRetryCount();
+        }
+        check(runs == 3 && retries == 2, "transaction retried up to the policy");
+    }
+    check(session->createQuery("SELECT COUNT(*) FROM t")->listMap().getInt64(0, 0) == 1, "failed attempts rolled back");
+
+    // 잠금 이외의 오류는 재시도하지 않습니다.
+    size_t runs = 0;
+    try {
+        session->inTransaction([&runs](ISession&) {
+            ++runs;
+            throw std::runtime_error("not a lock error");
+        }, fastRetry(5));
+    } catch (const std::runtime_error&) {
+    }
+    check(runs == 1, "other errors not retried");
+
+    // 시작 단계에서 잠금에 실패해도 격리 수준 설정이 세션에 남지 않습니다.
+    {
+        ExternalLock lock(database, "BEGIN IMMEDIATE");
+        TransactionDefinition definition;
+        definition.isolationLevel = IsolationLevel::READ_UNCOMMITTED;
+        definition.transactionMode = TransactionMode::IMMEDIATE;
+        bool lockFailed = false;
+        try {
+            session->beginTransaction(definition);
+        } catch (const LockAcquisitionException&) {
+            lockFailed = true;
+        }
+        check(lockFailed, "begin fails on lock");
+    }
+    check(session->createQuery("PRAGMA read_uncommitted")->listMap().getInt64(0, 0) == 0, "isolation level reset");
+
+    session->close();
+    std::remove(database);
+    if (failures == 0) {
+        std::cout << "LockRetryTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
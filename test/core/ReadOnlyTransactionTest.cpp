@@ -0,0 +1,141 @@
+// 읽기 전용 트랜잭션 및 공유 스냅샷 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "include/mapping/EntityReflection.h"
+#include "core/SessionFactory.h"
+#include "core/Session.h"
+#include "ORMException/DataAccessException/TransactionException/TransactionException.h"
+#include <cstdio>
+#include <functional>
+#include <iostream>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+class Item : public IEntity {
+public:
+    int64_t id = 0;
+    std::string name;
+    ZENIX_ENTITY(Item, id, name)
+};
+
+std::shared_ptr<Item> makeItem(int64_t id, const std::string& name) {
+    auto item = std::make_shared<Item>();
+    item->id = id;
+    item->name = name;
+    return item;
+}
+
+int64_t count(const std::shared_ptr<Session>& session) {
+    return session->createQuery("SELECT COUNT(*) FROM items")->listMap().getInt64(0, 0);
+}
+
+std::string nameOf(const std::shared_ptr<Session>& session, int id) {
+    return std::static_pointer_cast<Item>(session->find("Item", id))->name;
+}
+
+void removeDatabase(const std::string& database) {
+    for (const char* suffix : {"", "-wal", "-shm"}) {
+        std::remove((database + suffix).c_str());
+    }
+}
+
+} // namespace
+
+int main() {
+    const char* database = "read_only_transaction_test.db";
+    removeDatabase(database);
+
+    EntityMapper::getInstance().registerEntity(EntityReflection::makeMapping<Item>("items"));
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    config.setWalMode(true);
+    SessionFactory::getInstance().configure(config);
+
+    auto writer = SessionFactory::getInstance().openSession();
+    writer->createQuery("CREATE TABLE items (id INTEGER PRIMARY KEY, name TEXT)")->listMap();
+    writer->createQuery("INSERT INTO items VALUES (1, 'old')")->listMap();
+
+    TransactionDefinition readOnly;
+    readOnly.readOnly = true;
+
+    // 읽기 전용 트랜잭션 안의 쓰기는 실행 전에 거부됩니다.
+    auto reader = SessionFactory::getInstance().openSession();
+    auto tx = reader->beginTransaction(readOnly);
+    size_t rejected = 0;
+    std::vector<std::function<void()>> writes = {
+        [&] { reader->save(makeItem(0, "save")); },
+        [&] { reader->update(makeItem(1, "update")); },
+        [&] { reader->remove(makeItem(1, "remove")); },
+        [&] { reader->saveAll({makeItem(0, "batch")}); },
+    };
+    for (const auto& write : writes) {
+        try {
+            write();
+        } catch (const TransactionException&) {
+            ++rejected;
+        }
+    }
+    check(rejected == 4, "writes rejected in read-only transaction");
+
+    // 트랜잭션은 시작 시점의 데이터를 읽고, 그 사이 커밋된 변경은 2차 캐시를 거쳐서도 보이지 않습니다.
+    writer->createQuery("INSERT INTO items VALUES (2, 'new')")->listMap();
+    writer->update(makeItem(1, "updated"));
+    check(count(reader) == 1, "read-only transaction reads its start point");
+    check(nameOf(reader, 1) == "old", "find reads the transaction's point in time");
+    tx->commit();
+    check(count(reader) == 2, "later reads see committed rows");
+
+    // 이전 시점에서 읽은 엔티티는 2차 캐시에 남지 않습니다.
+    auto fresh = SessionFactory::getInstance().openSession();
+    check(nameOf(fresh, 1) == "updated", "stale entity not published to second-level cache");
+    fresh->close();
+
+    // 트랜잭션이 끝나면 다시 쓸 수 있습니다.
+    reader->update(makeItem(2, "writable"));
+    check(nameOf(writer, 2) == "writable", "writes allowed after read-only transaction");
+
+#ifdef SQLITE_ENABLE_SNAPSHOT
+    // 여러 세션이 같은 스냅샷의 시점을 공유합니다.
+    auto snapshot = SessionFactory::getInstance().captureSnapshot();
+    writer->createQuery("INSERT INTO items VALUES (3, 'after snapshot')")->listMap();
+    TransactionDefinition pinned = readOnly;
+    pinned.snapshot = snapshot;
+    auto first = SessionFactory::getInstance().openSession();
+    auto second = SessionFactory::getInstance().openSession();
+    auto firstTx = first->beginTransaction(pinned);
+    auto secondTx = second->beginTransaction(pinned);
+    check(count(first) == 2 && count(second) == 2, "sessions share the snapshot");
+    firstTx->commit();
+    secondTx->commit();
+    first->close();
+    second->close();
+#else
+    // 스냅샷을 지원하지 않는 SQLite에서는 명확히 실패하고 빌린 연결을 돌려줍니다.
+    bool unsupported = false;
+    try {
+        SessionFactory::getInstance().captureSnapshot();
+    } catch (const TransactionException&) {
+        unsupported = true;
+    }
+    check(unsupported, "snapshot unsupported without SQLITE_ENABLE_SNAPSHOT");
+    auto after = SessionFactory::getInstance().openSession();
+    check(count(after) == 2, "connection returned after failed capture");
+    after->close();
+#endif
+
+    reader->close();
+    writer->close();
+    removeDatabase(database);
+    if (failures == 0) {
+        std::cout << "ReadOnlyTransactionTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,160 @@
+// 세이브포인트 기반 중첩 트랜잭션 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "include/mapping/EntityReflection.h"
+#include "core/SessionFactory.h"
+#include "core/Session.h"
+#include "ORMException/DataAccessException/TransactionException/TransactionException.h"
+#include <sqlite3.h>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+class Item : public IEntity {
+public:
+    int64_t id = 0;
+    std::string name;
+    ZENIX_ENTITY(Item, id, name)
+};
+
+// 실행된 SAVEPOINT 문의 이름
+std::vector<std::string> savepointNames;
+
+int recordSavepoints(unsigned, void*, void* statement, void*) {
+    const char* sql = sqlite3_sql(static_cast<sqlite3_stmt*>(statement));
+    if (std::strncmp(sql, "SAVEPOINT ", 10) == 0) {
+        savepointNames.emplace_back(sql + 10);
+    }
+    return 0;
+}
+
+void insert(const std::shared_ptr<Session>& session, const std::string& name) {
+    auto item = std::make_shared<Item>();
+    item->name = name;
+    session->save(item);
+}
+
+std::string names(const std::shared_ptr<Session>& session) {
+    std::string result;
+    ResultSet rows = session->createQuery("SELECT name FROM items ORDER BY id")->listMap();
+    for (size_t i = 0; i < rows.rowCount(); ++i) {
+        result += (result.empty() ? "" : ",") + rows.getString(i, 0);
+    }
+    return result;
+}
+
+bool rejected(const std::shared_ptr<ITransaction>& transaction, bool commit) {
+    try {
+        commit ? transaction->commit() : transaction->rollback();
+    } catch (const TransactionException&) {
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+int main() {
+    const char* database = "savepoint_test.db";
+    std::remove(database);
+
+    EntityMapper::getInstance().registerEntity(EntityReflection::makeMapping<Item>("items"));
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    config.setMinPoolSize(1);
+    config.setMaxPoolSize(1);
+    SessionFactory::getInstance().configure(config);
+    auto connection = SessionFactory::getInstance().getConnection();
+    sqlite3_trace_v2(static_cast<sqlite3*>(connection->getNativeHandle()), SQLITE_TRACE_STMT, &recordSavepoints, nullptr);
+    SessionFactory::getInstance().releaseConnection(connection);
+
+    auto session = SessionFactory::getInstance().openSession();
+    session->createQuery("CREATE TABLE items (id INTEGER PRIMARY KEY, name TEXT)")->listMap();
+
+    // 안쪽 롤백은 그 세이브포인트의 변경만 되돌립니다.
+    auto outer = session->beginTransaction();
+    insert(session, "a");
+    auto inner = session->beginTransaction();
+    insert(session, "b");
+    inner->rollback();
+    auto released = session->beginTransaction();
+    insert(session, "c");
+    released->commit();
+    outer->commit();
+    check(names(session) == "a,c", "inner rollback and release");
+
+    // 이름은 깊이와 세션별 번호로 만들어 서로 겹치지 않습니다.
+    check(savepointNames.size() == 2 && savepointNames[0] != savepointNames[1], "unique savepoint names");
+    check(savepointNames.size() == 2 && savepointNames[0].find("_1_") != std::string::npos, "name carries depth");
+
+    // 끝난 중첩 트랜잭션 객체는 같은 깊이의 새 세이브포인트에 영향을 주지 않습니다.
+    check(rejected(inner, false) && rejected(released, true), "completed nested transaction rejected");
+
+    // 바깥 세이브포인트를 롤백하면 안쪽 세이브포인트도 함께 끝납니다.
+    outer = session->beginTransaction();
+    auto middle = session->beginTransaction();
+    insert(session, "d");
+    auto innermost = session->beginTransaction();
+    insert(session, "e");
+    middle->rollback();
+    check(rejected(innermost, true), "inner savepoint ends with its parent");
+    insert(session, "f");
+    outer->commit();
+    check(names(session) == "a,c,f", "rollback of middle level");
+
+    // 바깥 트랜잭션을 롤백하면 이미 해제된 안쪽 변경도 사라집니다.
+    outer = session->beginTransaction();
+    inner = session->beginTransaction();
+    insert(session, "g");
+    inner->commit();
+    outer->rollback();
+    check(names(session) == "a,c,f", "outer rollback discards released savepoint");
+
+    // inTransaction을 중첩하면 실패한 작업만 되돌리고 바깥 작업은 계속됩니다.
+    session->inTransaction([](ISession& current) {
+        auto item = std::make_shared<Item>();
+        item->name = "h";
+        current.save(item);
+        try {
+            current.inTransaction([](ISession& nested) {
+                auto failed = std::make_shared<Item>();
+                failed->name = "nested";
+                nested.save(failed);
+                throw std::runtime_error("nested work failed");
+            });
+        } catch (const std::runtime_error&) {
+        }
+    });
+    check(names(session) == "a,c,f,h", "nested inTransaction failure isolated");
+
+    // 롤백된 세이브포인트에서 수정한 엔티티는 1차 캐시에서도 폐기됩니다.
+    auto cached = std::static_pointer_cast<Item>(session->find("Item", 1));
+    outer = session->beginTransaction();
+    inner = session->beginTransaction();
+    auto changed = std::make_shared<Item>();
+    changed->id = cached->id;
+    changed->name = "changed";
+    session->update(changed);
+    inner->rollback();
+    check(std::static_pointer_cast<Item>(session->find("Item", 1))->name == "a", "session cache restored");
+    outer->commit();
+
+    session->close();
+    std::remove(database);
+    if (failures == 0) {
+        std::cout << "SavepointTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
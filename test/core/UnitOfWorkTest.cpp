@@ -0,0 +1,192 @@
+// FlushMode::Commit (Unit of Work) 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "include/mapping/EntityReflection.h"
+#include "core/SessionFactory.h"
+#include "core/Session.h"
+#include <sqlite3.h>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+class Customer : public IEntity {
+public:
+    int64_t id = 0;
+    std::string name;
+    ZENIX_ENTITY(Customer, id, name)
+};
+
+class Order : public IEntity {
+public:
+    int64_t id = 0;
+    std::string name;
+    int64_t customer_id = 0;
+    ZENIX_ENTITY(Order, id, name, customer_id)
+};
+
+// 실행된 쓰기 문 ("INSERT customers", "DELETE orders" 형태)
+std::vector<std::string> writes;
+
+int recordWrites(unsigned, void*, void* statement, void*) {
+    const char* sql = sqlite3_sql(static_cast<sqlite3_stmt*>(statement));
+    for (const char* prefix : {"INSERT INTO ", "UPDATE ", "DELETE FROM "}) {
+        size_t length = std::strlen(prefix);
+        if (std::strncmp(sql, prefix, length) == 0) {
+            std::string table(sql + length);
+            table = table.substr(0, table.find_first_of(" ("));
+            writes.push_back(std::string(prefix, std::strchr(prefix, ' ')) + " " + table);
+        }
+    }
+    return 0;
+}
+
+std::shared_ptr<Customer> makeCustomer(int64_t id, const std::string& name) {
+    auto customer = std::make_shared<Customer>();
+    customer->id = id;
+    customer->name = name;
+    return customer;
+}
+
+std::shared_ptr<Order> makeOrder(int64_t id, const std::string& name, int64_t customerId) {
+    auto order = std::make_shared<Order>();
+    order->id = id;
+    order->name = name;
+    order->customer_id = customerId;
+    return order;
+}
+
+std::string names(const std::shared_ptr<Session>& session, const std::string& table) {
+    std::string result;
+    ResultSet rows = session->createQuery("SELECT name FROM " + table + " ORDER BY id")->listMap();
+    for (size_t i = 0; i < rows.rowCount(); ++i) {
+        result += (result.empty() ? "" : ",") + rows.getString(i, 0);
+    }
+    return result;
+}
+
+} // namespace
+
+int main() {
+    const char* database = "unit_of_work_test.db";
+    std::remove(database);
+
+    EntityMapper::getInstance().registerEntity(EntityReflection::makeMapping<Customer>("customers"));
+    EntityMapping orderMapping = EntityReflection::makeMapping<Order>("orders");
+    orderMapping.relationships.push_back(Relationship{"customer", "ManyToOne", "Customer", "", "customer_id"});
+    EntityMapper::getInstance().registerEntity(orderMapping);
+
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    config.setMinPoolSize(1);
+    config.setMaxPoolSize(1);
+    SessionFactory::getInstance().configure(config);
+    auto connection = SessionFactory::getInstance().getConnection();
+    sqlite3_trace_v2(static_cast<sqlite3*>(connection->getNativeHandle()), SQLITE_TRACE_STMT, &recordWrites, nullptr);
+    SessionFactory::getInstance().releaseConnection(connection);
+
+    auto session = SessionFactory::getInstance().openSession();
+    session->createQuery("PRAGMA foreign_keys = ON")->listMap();
+    session->createQuery("CREATE TABLE customers (id INTEGER PRIMARY KEY, name TEXT)")->listMap();
+    session->createQuery("CREATE TABLE orders (id INTEGER PRIMARY KEY, name TEXT, "
+                         "customer_id INTEGER REFERENCES customers(id))")->listMap();
+    session->setFlushMode(FlushMode::Commit);
+    check(session->getFlushMode() == FlushMode::Commit, "flush mode");
+
+    // 쓰기는 커밋할 때까지 미뤄지고, 참조되는 엔티티부터 INSERT합니다. (ID는 테이블이 부여하는 순서와 맞춤)
+    auto tx = session->beginTransaction();
+    auto kim = makeCustomer(1, "kim");
+    auto first = makeOrder(1, "a", 1);
+    session->save(first);
+    session->save(kim);
+    session->save(makeOrder(2, "b", 1));
+    writes.clear();
+    check(names(session, "orders").empty(), "writes deferred until commit");
+    tx->commit();
+    check(writes == std::vector<std::string>({"INSERT customers", "INSERT orders"}),
+          "parent inserted before children in one statement per table");
+    check(names(session, "customers") == "kim" && names(session, "orders") == "a,b", "rows after commit");
+
+    // 같은 엔티티에 대한 여러 UPDATE는 하나로 합쳐지고 마지막 값이 쓰입니다.
+    tx = session->beginTransaction();
+    first->name = "a2";
+    session->update(first);
+    first->name = "a3";
+    session->update(first);
+    writes.clear();
+    tx->commit();
+    check(writes == std::vector<std::string>({"UPDATE orders"}), "updates collapsed");
+    check(names(session, "orders") == "a3,b", "last value written");
+
+    // 저장 후 삭제한 엔티티는 아무 문도 실행하지 않습니다.
+    tx = session->beginTransaction();
+    auto transient = makeOrder(0, "c", 1);
+    session->save(transient);
+    session->remove(transient);
+    writes.clear();
+    tx->commit();
+    check(writes.empty(), "save then remove cancelled");
+
+    // 저장 후 수정하면 flush 시점의 값으로 INSERT 하나만 실행합니다.
+    tx = session->beginTransaction();
+    auto late = makeOrder(3, "d", 1);
+    session->save(late);
+    late->name = "d2";
+    session->update(late);
+    writes.clear();
+    tx->commit();
+    check(writes == std::vector<std::string>({"INSERT orders"}), "save then update is one INSERT");
+    check(names(session, "orders") == "a3,b,d2", "INSERT uses latest value");
+
+    // DELETE는 참조하는 엔티티부터 실행합니다.
+    tx = session->beginTransaction();
+    session->remove(kim);
+    session->removeAll({first, session->find("Order", 2), late});
+    writes.clear();
+    tx->commit();
+    check(writes == std::vector<std::string>({"DELETE orders", "DELETE customers"}), "children deleted before parent");
+    check(names(session, "customers").empty() && names(session, "orders").empty(), "rows after delete");
+
+    // 롤백하면 아직 실행하지 않은 작업도 버립니다.
+    tx = session->beginTransaction();
+    session->save(makeCustomer(2, "lee"));
+    writes.clear();
+    tx->rollback();
+    check(writes.empty(), "queued writes discarded on rollback");
+    session->flush();
+    check(names(session, "customers").empty(), "nothing left to flush");
+
+    // 세이브포인트를 롤백하면 그 안에서 넣은 작업만 버립니다.
+    tx = session->beginTransaction();
+    session->save(makeCustomer(3, "park"));
+    auto nested = session->beginTransaction();
+    session->save(makeCustomer(4, "choi"));
+    nested->rollback();
+    tx->commit();
+    check(names(session, "customers") == "park", "savepoint rollback discards its queued writes");
+
+    // 트랜잭션 밖에서는 flush()를 호출해야 실행되고, Immediate로 돌아가면 남은 작업을 실행합니다.
+    session->save(makeCustomer(5, "jung"));
+    check(names(session, "customers") == "park", "deferred outside transaction");
+    session->flush();
+    check(names(session, "customers") == "park,jung", "explicit flush");
+    session->save(makeCustomer(6, "han"));
+    session->setFlushMode(FlushMode::Immediate);
+    check(names(session, "customers") == "park,jung,han", "switching to Immediate flushes");
+
+    session->close();
+    std::remove(database);
+    if (failures == 0) {
+        std::cout << "UnitOfWorkTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
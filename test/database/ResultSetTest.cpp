@@ -0,0 +1,84 @@
+// ResultSet 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "database/DatabaseConnectionFactory.h"
+#include "database/ResultSet.h"
+#include "ORMException/InvalidParameterException/InvalidParameterException.h"
+#include <iostream>
+#include <string>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+std::string realString(double value) {
+    ColumnValue cell;
+    cell.type = ColumnType::Real;
+    cell.real = value;
+    return cell.toString();
+}
+
+} // namespace
+
+int main() {
+    // 직접 작성한 결과 집합
+    ResultSet rows({"id", "score", "name", "data"});
+    rows.appendInt64(1);
+    rows.appendDouble(2.5);
+    rows.appendText("kim", 3);
+    rows.appendBlob("a\0b", 3);
+    rows.appendInt64(2);
+    rows.appendNull();
+    rows.appendText("42", 2);
+    rows.appendBlob(nullptr, 0);
+
+    check(rows.rowCount() == 2 && rows.columnCount() == 4, "row and column count");
+    check(rows.findColumn("name") == 2 && rows.findColumn("missing") == -1, "findColumn");
+    check(rows.getType(0, 1) == ColumnType::Real && rows.isNull(1, 1), "cell types");
+    check(rows.getText(0, 3).size() == 3 && rows.getText(0, 3)[1] == '\0', "blob with embedded NUL");
+    check(rows.getType(1, 3) == ColumnType::Blob && rows.getText(1, 3).empty(), "empty blob is not NULL");
+    check(rows.getInt64(1, 2) == 42 && rows.getDouble(0, 0) == 1.0, "numeric conversion");
+    check(rows.getString(1, "name") == "42" && rows.getString(1, 1).empty(), "getString by name and NULL");
+
+    ResultSet copy = rows;
+    check(copy.getColumnNames() == rows.getColumnNames() && copy.getString(0, 2) == "kim", "copy keeps cells");
+
+    bool threw = false;
+    try {
+        rows.getString(0, "missing");
+    } catch (const InvalidParameterException&) {
+        threw = true;
+    }
+    check(threw, "unknown column name");
+
+    // REAL은 되돌릴 수 있는 정밀도로, 정수 값은 ".0"을 붙여 출력합니다.
+    check(realString(3.0) == "3.0", "integral REAL");
+    check(realString(0.1) == "0.1", "shortest REAL");
+    check(realString(0.1 + 0.2) == "0.30000000000000004", "round-trip REAL");
+    check(realString(1e20) == "1.0e+20", "integral REAL with exponent");
+    check(realString(-2.5) == "-2.5", "negative REAL");
+
+    // 연결이 만든 결과 집합
+    DatabaseConfig config;
+    config.setDatabaseName(":memory:");
+    auto connection = DatabaseConnectionFactory::createConnection(config);
+    connection->connect();
+    ResultSet result = connection->executeQuery("SELECT 7 AS i, 1.5 AS r, 'x' AS t, x'0001' AS b, NULL AS n");
+    check(result.rowCount() == 1, "query row");
+    check(result.getType(0, 0) == ColumnType::Integer && result.getInt64(0, 0) == 7, "INTEGER column");
+    check(result.getType(0, 1) == ColumnType::Real && result.getString(0, 1) == "1.5", "REAL column");
+    check(result.getType(0, 3) == ColumnType::Blob && result.getText(0, 3).size() == 2, "BLOB column");
+    check(result.isNull(0, 4), "NULL column");
+    connection->disconnect();
+
+    if (failures == 0) {
+        std::cout << "ResultSetTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
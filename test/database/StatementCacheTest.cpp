@@ -0,0 +1,79 @@
+// StatementCache 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "database/SQLite/StatementCache.h"
+#include <iostream>
+#include <string>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+} // namespace
+
+int main() {
+    sqlite3* db = nullptr;
+    sqlite3_open(":memory:", &db);
+
+    {
+        StatementCache cache(2);
+
+        // 반납한 문은 같은 SQL로 다시 대여됩니다.
+        sqlite3_stmt* first = cache.acquire(db, "SELECT ?1");
+        sqlite3_bind_int(first, 1, 7);
+        sqlite3_step(first);
+        cache.release(first);
+        sqlite3_stmt* again = cache.acquire(db, "SELECT ?1");
+        check(again == first, "released statement reused");
+        check(sqlite3_step(again) == SQLITE_ROW && sqlite3_column_type(again, 0) == SQLITE_NULL,
+              "bindings cleared on release");
+
+        // 같은 SQL이 사용 중이면 캐시되지 않는 문을 따로 준비합니다.
+        sqlite3_stmt* nested = cache.acquire(db, "SELECT ?1");
+        check(nested != again, "statement in use is not shared");
+        cache.release(nested);
+        cache.release(again);
+        check(cache.size() == 1, "nested statement not cached");
+
+        // 용량을 넘으면 가장 오래 사용되지 않은 문과 그 부가 정보를 제거합니다.
+        auto attachment = std::make_shared<int>(1);
+        std::weak_ptr<int> watched = attachment;
+        cache.setAttachment(first, "plan", std::move(attachment));
+        check(cache.getAttachment(first, "plan") != nullptr, "attachment stored");
+        cache.release(cache.acquire(db, "SELECT 2"));
+        cache.release(cache.acquire(db, "SELECT 3"));
+        check(cache.size() == 2, "capacity enforced");
+        check(watched.expired(), "attachment released with evicted statement");
+
+        // 사용 중인 문은 제거하지 않습니다.
+        sqlite3_stmt* busy = cache.acquire(db, "SELECT 4");
+        cache.release(cache.acquire(db, "SELECT 5"));
+        cache.release(cache.acquire(db, "SELECT 6"));
+        check(cache.getAttachment(busy, "missing") == nullptr, "unknown attachment key");
+        sqlite3_stmt* reused = cache.acquire(db, "SELECT 5");
+        cache.release(reused);
+        cache.release(busy);
+        check(cache.size() <= 2, "evicted after in-use statement released");
+
+        // 준비할 수 없는 SQL은 예외를 던집니다.
+        bool threw = false;
+        try {
+            cache.acquire(db, "SELEC 1");
+        } catch (const std::exception&) {
+            threw = true;
+        }
+        check(threw, "prepare error reported");
+    }
+
+    sqlite3_close(db);
+    if (failures == 0) {
+        std::cout << "StatementCacheTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+// TuningProfile 적용 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "database/DatabaseConnectionFactory.h"
+#include "ORMException/ConfigurationException/ConfigurationException.h"
+#include "ORMException/DataAccessException/LockAcquisitionException/LockAcqusitionException.h"
+#include <sqlite3.h>
+#include <cstdio>
+#include <iostream>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+std::string pragma(const std::shared_ptr<IDatabaseConnection>& connection, const std::string& name) {
+    return connection->executeQuery("PRAGMA " + name).getString(0, 0);
+}
+
+// 다른 연결이 배타 잠금을 잡은 동안 쓰기를 시도하고, 실패까지 걸린 시간을 반환합니다.
+std::chrono::milliseconds timeBlockedWrite(const std::shared_ptr<IDatabaseConnection>& connection, const char* database) {
+    sqlite3* locker = nullptr;
+    sqlite3_open(database, &locker);
+    sqlite3_exec(locker, "BEGIN EXCLUSIVE", nullptr, nullptr, nullptr);
+    auto start = std::chrono::steady_clock::now();
+    try {
+        connection->executeUpdate("INSERT INTO t VALUES (NULL)");
+    } catch (const LockAcquisitionException&) {
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    sqlite3_exec(locker, "ROLLBACK", nullptr, nullptr, nullptr);
+    sqlite3_close(locker);
+    return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed);
+}
+
+} // namespace
+
+int main() {
+    const char* database = "tuning_profile_test.db";
+    for (const char* suffix : {"", "-wal", "-shm"}) {
+        std::remove((std::string(database) + suffix).c_str());
+    }
+
+    // 새 데이터베이스에 각 PRAGMA가 적용됩니다.
+    TuningProfile tuning;
+    tuning.pageSize = 8192;
+    tuning.journalMode = JournalMode::WAL;
+    tuning.synchronous = SynchronousMode::Normal;
+    tuning.cacheSizeKiB = 2048;
+    tuning.mmapSize = 1024 * 1024;
+    tuning.tempStore = TempStore::Memory;
+
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    config.setTuningProfile(tuning);
+    config.setRetryPolicy(RetryPolicy::none());
+    auto connection = DatabaseConnectionFactory::createConnection(config);
+    connection->connect();
+    check(pragma(connection, "page_size") == "8192", "page_size");
+    check(pragma(connection, "journal_mode") == "wal", "journal_mode");
+    check(pragma(connection, "synchronous") == "1", "synchronous");
+    check(pragma(connection, "cache_size") == "-2048", "cache_size in KiB");
+    check(pragma(connection, "mmap_size") == "1048576", "mmap_size");
+    check(pragma(connection, "temp_store") == "2", "temp_store");
+    connection->executeUpdate("CREATE TABLE t (id INTEGER PRIMARY KEY)");
+
+    // 읽기 전용 연결은 파일의 저널 모드를 바꾸지 않습니다.
+    DatabaseConfig readerConfig = config;
+    TuningProfile readerTuning = tuning;
+    readerTuning.journalMode = JournalMode::Delete;
+    readerConfig.setTuningProfile(readerTuning);
+    readerConfig.setReadOnly(true);
+    auto reader = DatabaseConnectionFactory::createConnection(readerConfig);
+    reader->connect();
+    check(pragma(reader, "journal_mode") == "wal", "reader keeps writer's journal mode");
+    reader->disconnect();
+
+    // busyTimeout이 0이면 잠금 경합 시 기다리지 않고 바로 실패합니다.
+    check(timeBlockedWrite(connection, database) < std::chrono::milliseconds(100), "no busy wait by default");
+    connection->disconnect();
+
+    // busyTimeout이 있으면 한도까지 백오프하며 기다린 뒤 실패합니다.
+    tuning.busyTimeout = std::chrono::milliseconds(300);
+    config.setTuningProfile(tuning);
+    auto waiting = DatabaseConnectionFactory::createConnection(config);
+    waiting->connect();
+    auto waited = timeBlockedWrite(waiting, database);
+    check(waited >= std::chrono::milliseconds(100) && waited < std::chrono::milliseconds(2000), "busy handler waits");
+    waiting->disconnect();
+
+    // 프리셋
+    check(TuningProfile::preset("durable").synchronous == SynchronousMode::Full, "durable preset");
+    check(TuningProfile::preset("throughput").journalMode == JournalMode::WAL, "throughput preset");
+    check(TuningProfile::preset("read-replica").journalMode == JournalMode::Default, "read-replica keeps journal mode");
+    check(TuningProfile::preset("default").busyTimeout.count() == 0, "default preset");
+    bool anyNoMutex = false;
+    for (const char* name : {"default", "durable", "throughput", "read-replica"}) {
+        anyNoMutex = anyNoMutex || TuningProfile::preset(name).noMutex;
+    }
+    check(!anyNoMutex, "no preset disables connection mutex");
+    bool unknown = false;
+    try {
+        TuningProfile::preset("fastest");
+    } catch (const ConfigurationException&) {
+        unknown = true;
+    }
+    check(unknown, "unknown preset");
+
+    for (const char* suffix : {"", "-wal", "-shm"}) {
+        std::remove((std::string(database) + suffix).c_str());
+    }
+    if (failures == 0) {
+        std::cout << "TuningProfileTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
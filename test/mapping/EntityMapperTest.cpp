@@ -0,0 +1,101 @@
+// EntityMapper 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "include/mapping/EntityReflection.h"
+#include "include/mapping/EntityMapper.h"
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+class Book : public IEntity {
+public:
+    int64_t id = 0;
+    std::string title;
+    int64_t pages = 0;
+    ZENIX_ENTITY(Book, id, title, pages)
+};
+
+class Tag : public IEntity {
+public:
+    int64_t id = 0;
+    ZENIX_ENTITY(Tag, id)
+};
+
+} // namespace
+
+int main() {
+    EntityMapper& mapper = EntityMapper::getInstance();
+    mapper.registerEntity(EntityReflection::makeMapping<Book>("books"));
+    mapper.registerEntity(EntityReflection::makeMapping<Tag>("tags"));
+
+    // 등록 시 한 번 생성된 CRUD SQL
+    auto book = mapper.getMapping("Book");
+    check(book != nullptr, "mapping registered");
+    if (book) {
+        check(book->sql.insert == "INSERT INTO books (title, pages) VALUES (?, ?);", "insert SQL");
+        check(book->sql.update == "UPDATE books SET title = ?, pages = ? WHERE id = ?;", "update SQL");
+        check(book->sql.remove == "DELETE FROM books WHERE id = ?;", "delete SQL");
+        check(book->sql.selectById == "SELECT * FROM books WHERE id = ?;", "select SQL");
+        check(book->sql.columnList == "title, pages" && book->sql.rowPlaceholder == "(?, ?)", "multi-row parts");
+    }
+
+    // 필드가 없는 엔티티는 DEFAULT VALUES로 삽입하고 UPDATE 문이 없습니다.
+    auto tag = mapper.getMapping("Tag");
+    check(tag && tag->sql.insert == "INSERT INTO tags DEFAULT VALUES;" && tag->sql.update.empty(), "entity without fields");
+
+    // 조회는 같은 불변 매핑을 공유합니다.
+    check(mapper.getMapping("Book") == book, "lookups share the mapping");
+    check(mapper.getMappingByTableName("books") == book, "lookup by table");
+    check(book && mapper.getMappingByTypeId(book->typeId) == book, "lookup by type id");
+    check(mapper.getMapping("Missing") == nullptr && mapper.getMappingByTypeId(9999) == nullptr, "unknown mapping");
+
+    // 재등록은 타입 ID를 유지하고 테이블 색인을 옮기며, 대체된 매핑은 더 이상 붙잡지 않습니다.
+    uint32_t typeId = book ? book->typeId : 0;
+    std::weak_ptr<const EntityMapping> superseded = book;
+    book.reset();
+    mapper.registerEntity(EntityReflection::makeMapping<Book>("archived_books"));
+    auto moved = mapper.getMapping("Book");
+    check(moved && moved->typeId == typeId && mapper.getMappingByTypeId(typeId) == moved, "type id kept");
+    check(mapper.getMappingByTableName("archived_books") == moved, "new table indexed");
+    check(mapper.getMappingByTableName("books") == nullptr, "old table unindexed");
+    check(superseded.expired(), "superseded mapping released");
+
+    // 등록 중에도 조회는 항상 완전한 매핑을 봅니다.
+    std::atomic<bool> stop{false};
+    std::atomic<int> torn{0};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([&] {
+            while (!stop) {
+                auto mapping = mapper.getMapping("Book");
+                if (!mapping || mapping->typeId != typeId || mapping->sql.selectById.empty()) {
+                    ++torn;
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 200; ++i) {
+        mapper.registerEntity(EntityReflection::makeMapping<Book>(i % 2 ? "books" : "archived_books"));
+    }
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    check(torn == 0, "concurrent lookups during registration");
+
+    if (failures == 0) {
+        std::cout << "EntityMapperTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,127 @@
+// EntityReflection 필드 접근자 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "include/mapping/EntityReflection.h"
+#include "core/SessionFactory.h"
+#include "core/Session.h"
+#include <cstdio>
+#include <iostream>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+class Sample : public IEntity {
+public:
+    int64_t id = 0;
+    int count = 0;
+    bool active = false;
+    double ratio = 0.0;
+    std::string label;
+    Blob payload;
+    ZENIX_ENTITY(Sample, id, count, active, ratio, label, payload)
+};
+
+ColumnValue integer(int64_t value) {
+    ColumnValue column;
+    column.type = ColumnType::Integer;
+    column.integer = value;
+    return column;
+}
+
+ColumnValue text(std::string_view value) {
+    ColumnValue column;
+    column.type = ColumnType::Text;
+    column.text = value;
+    return column;
+}
+
+} // namespace
+
+int main() {
+    const char* database = "entity_reflection_test.db";
+    std::remove(database);
+
+    // 매핑: 첫 멤버가 ID이고 나머지는 선언 순서대로 필드가 됩니다.
+    EntityMapping mapping = EntityReflection::makeMapping<Sample>("samples");
+    check(mapping.entityName == "Sample" && mapping.idColumnName == "id", "entity and id names");
+    check(mapping.fields.size() == 5 && mapping.fields[0].fieldName == "count" && mapping.fields[4].columnName == "payload",
+          "fields in declaration order");
+    check(mapping.fields[0].accessor.type == ColumnType::Integer && mapping.fields[1].accessor.type == ColumnType::Integer &&
+              mapping.fields[2].accessor.type == ColumnType::Real && mapping.fields[3].accessor.type == ColumnType::Text &&
+              mapping.fields[4].accessor.type == ColumnType::Blob,
+          "column types from member types");
+    check(std::dynamic_pointer_cast<Sample>(mapping.entityConstructor()) != nullptr, "constructor");
+
+    // 접근자는 멤버를 타입 그대로 읽고 씁니다.
+    Sample sample;
+    sample.count = 7;
+    sample.active = true;
+    sample.ratio = 0.1;
+    sample.label = "tag";
+    sample.payload = Blob{0, 1, 2};
+    check(std::get<int64_t>(mapping.fields[0].readParameter(sample)) == 7, "read integer");
+    check(std::get<int64_t>(mapping.fields[1].readParameter(sample)) == 1, "read bool as integer");
+    check(std::get<double>(mapping.fields[2].readParameter(sample)) == 0.1, "read double");
+    check(std::get<std::string_view>(mapping.fields[3].readParameter(sample)).data() == sample.label.data(),
+          "read string without copy");
+    check(std::get<BlobView>(mapping.fields[4].readParameter(sample)).size == 3, "read blob");
+
+    mapping.fields[0].assign(sample, integer(42));
+    mapping.fields[2].assign(sample, text("2.5"));
+    mapping.fields[3].assign(sample, integer(5));
+    mapping.fields[4].assign(sample, text(std::string_view("\0x", 2)));
+    check(sample.count == 42 && sample.ratio == 2.5, "write numbers with type affinity");
+    check(sample.label == "5" && sample.payload == Blob{0, 'x'}, "write text and blob");
+    mapping.fields[0].assign(sample, ColumnValue());
+    check(sample.count == 0, "NULL resets member");
+    mapping.assignId(sample, integer(9));
+    check(sample.id == 9 && sample.getId() == "9", "id accessor");
+
+    // 문자열 기반 IEntity 메서드
+    Sample unsaved;
+    check(unsaved.getId().empty(), "unsaved id is empty");
+    unsaved.setFieldValue("count", "12");
+    check(unsaved.count == 12 && std::any_cast<int>(unsaved.getFieldValue("count")) == 12, "string-based access");
+    bool unknown = false;
+    try {
+        unsaved.getFieldValue("missing");
+    } catch (const MappingException&) {
+        unknown = true;
+    }
+    check(unknown, "unknown field");
+
+    // 저장 후 다시 읽어도 값이 그대로입니다.
+    EntityMapper::getInstance().registerEntity(mapping);
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    SessionFactory::getInstance().configure(config);
+    auto session = SessionFactory::getInstance().openSession();
+    session->createQuery("CREATE TABLE samples (id INTEGER PRIMARY KEY, count INTEGER, active INTEGER, ratio REAL, "
+                         "label TEXT, payload BLOB)")->listMap();
+    auto stored = std::make_shared<Sample>();
+    stored->count = -3;
+    stored->active = true;
+    stored->ratio = 0.1 + 0.2;
+    stored->label = "round trip";
+    stored->payload = Blob{255, 0, 128};
+    session->save(stored);
+    auto loaded = session->createQuery("SELECT * FROM samples")->list();
+    auto copy = loaded.empty() ? nullptr : std::static_pointer_cast<Sample>(loaded[0]);
+    check(copy && copy->id == 1 && copy->count == -3 && copy->active, "integers round trip");
+    check(copy && copy->ratio == 0.1 + 0.2 && copy->label == "round trip" && copy->payload == stored->payload,
+          "double, text and blob round trip");
+
+    session->close();
+    std::remove(database);
+    if (failures == 0) {
+        std::cout << "EntityReflectionTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
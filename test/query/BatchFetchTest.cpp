@@ -0,0 +1,151 @@
+// 지연 관계의 일괄 로딩(batch fetch) 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "include/mapping/EntityReflection.h"
+#include "core/SessionFactory.h"
+#include "core/Session.h"
+#include "ORMException/LazyInitializationException/LazyInitializationException.h"
+#include <sqlite3.h>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+// 살아 있는 Customer 인스턴스 수
+int aliveCustomers = 0;
+
+class Customer : public IEntity {
+public:
+    int64_t id = 0;
+    std::string name;
+    Customer() { ++aliveCustomers; }
+    ~Customer() override { --aliveCustomers; }
+    ZENIX_ENTITY(Customer, id, name)
+};
+
+class Order : public IEntity {
+public:
+    int64_t id = 0;
+    std::string name;
+    int64_t customer_id = 0;
+    ZENIX_ENTITY(Order, id, name, customer_id)
+};
+
+// 실행된 IN 조회문
+std::vector<std::string> inQueries;
+
+int recordInQueries(unsigned, void*, void* statement, void*) {
+    const char* sql = sqlite3_sql(static_cast<sqlite3_stmt*>(statement));
+    if (std::strncmp(sql, "SELECT", 6) == 0 && std::strstr(sql, " IN (") != nullptr) {
+        inQueries.emplace_back(sql);
+    }
+    return 0;
+}
+
+std::string customerName(const std::shared_ptr<IEntity>& order) {
+    auto customer = order->relation("customer").getOne();
+    return customer ? std::static_pointer_cast<Customer>(customer)->name : "(null)";
+}
+
+bool lazyFailure(const std::shared_ptr<IEntity>& entity, const std::string& relationName) {
+    try {
+        entity->relation(relationName).get();
+    } catch (const LazyInitializationException&) {
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+int main() {
+    const char* database = "batch_fetch_test.db";
+    std::remove(database);
+
+    EntityMapping customerMapping = EntityReflection::makeMapping<Customer>("customers");
+    customerMapping.relationships.push_back(Relationship{"orders", "OneToMany", "Order", "customer", ""});
+    EntityMapper::getInstance().registerEntity(customerMapping);
+    EntityMapping orderMapping = EntityReflection::makeMapping<Order>("orders");
+    orderMapping.relationships.push_back(Relationship{"customer", "ManyToOne", "Customer", "", "customer_id"});
+    EntityMapper::getInstance().registerEntity(orderMapping);
+
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    config.setMinPoolSize(1);
+    config.setMaxPoolSize(1);
+    config.setBatchFetchSize(2);
+    SessionFactory::getInstance().configure(config);
+    auto connection = SessionFactory::getInstance().getConnection();
+    sqlite3_trace_v2(static_cast<sqlite3*>(connection->getNativeHandle()), SQLITE_TRACE_STMT, &recordInQueries, nullptr);
+    SessionFactory::getInstance().releaseConnection(connection);
+
+    auto session = SessionFactory::getInstance().openSession();
+    session->createQuery("CREATE TABLE customers (id INTEGER PRIMARY KEY, name TEXT)")->listMap();
+    session->createQuery("CREATE TABLE orders (id INTEGER PRIMARY KEY, name TEXT, customer_id INTEGER)")->listMap();
+    session->createQuery("INSERT INTO customers VALUES (1, 'kim'), (2, 'lee'), (3, 'park'), (4, 'choi'), (5, 'jung')")
+        ->listMap();
+    session->createQuery("INSERT INTO orders VALUES (1, 'a', 1), (2, 'b', 2), (3, 'c', 3), (4, 'd', 4), (5, 'e', 5), "
+                         "(6, 'f', 1), (7, 'g', NULL)")->listMap();
+
+    // 첫 접근에서 결과 전체의 외래 키를 중복 없이 batch 크기씩 나눠 IN 조회합니다.
+    auto orders = session->createQuery("SELECT * FROM orders ORDER BY id")->list();
+    check(orders.size() == 7 && !orders[0]->relation("customer").isLoaded(), "relation not loaded before access");
+    inQueries.clear();
+    check(customerName(orders[0]) == "kim", "related entity loaded");
+    check(inQueries.size() == 3, "5 distinct keys in chunks of 2");
+    check(!inQueries.empty() && inQueries[0].find("IN (?, ?)") != std::string::npos, "chunk size from batch fetch size");
+
+    // 같은 결과의 다른 엔티티는 추가 조회 없이 관계를 얻습니다.
+    inQueries.clear();
+    check(orders[6]->relation("customer").isLoaded(), "whole result loaded together");
+    check(customerName(orders[4]) == "jung" && customerName(orders[5]) == "kim", "other entities resolved");
+    check(customerName(orders[6]) == "(null)", "NULL foreign key has no related entity");
+    check(inQueries.empty(), "no query after the batch");
+
+    // 반대쪽(OneToMany) 관계도 소유 ID로 일괄 조회합니다.
+    auto customers = session->createQuery("SELECT * FROM customers ORDER BY id")->list();
+    inQueries.clear();
+    check(customers.size() == 5 && customers[0]->relation("orders").get().size() == 2, "one-to-many loaded");
+    check(customers.size() == 5 && customers[4]->relation("orders").get().size() == 1, "one-to-many of other entity");
+    check(inQueries.size() == 3, "one-to-many chunked by batch fetch size");
+
+    // 쿼리 결과가 아닌 엔티티와 닫힌 세션의 엔티티는 관계를 로드할 수 없습니다.
+    check(lazyFailure(std::make_shared<Order>(), "customer"), "entity not produced by a query");
+    auto unloaded = session->createQuery("SELECT * FROM orders WHERE id = 2")->list();
+    session->close();
+    check(unloaded.size() == 1 && lazyFailure(unloaded[0], "customer"), "access after session close");
+    orders.clear();
+    customers.clear();
+    unloaded.clear();
+
+    // 세션의 1차 캐시에 있는 관계 엔티티는 약한 참조로 보관해 세션과 함께 해제됩니다.
+    // (트랜잭션 안에서 읽어 2차 캐시에는 들어가지 않게 함)
+    session = SessionFactory::getInstance().openSession();
+    int baseline = aliveCustomers;
+    auto tx = session->beginTransaction();
+    auto cached = session->find("Customer", 1);
+    auto builder = session->createQueryBuilder();
+    builder->select("*").from("orders").where("id = 1").fetchJoin("customer");
+    auto joined = builder->getQuery()->list();
+    check(joined.size() == 1 && joined[0]->relation("customer").getOne() == cached, "fetch join returns cached instance");
+    cached.reset();
+    tx->commit();
+    session->close();
+    check(aliveCustomers == baseline, "session-owned related entity released with its session");
+    check(joined.size() == 1 && lazyFailure(joined[0], "customer"), "released related entity reported");
+
+    std::remove(database);
+    if (failures == 0) {
+        std::cout << "BatchFetchTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,92 @@
+// QueryBuilder::fetchJoin 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "include/mapping/EntityReflection.h"
+#include "core/SessionFactory.h"
+#include "core/Session.h"
+#include <cstdio>
+#include <iostream>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+class Customer : public IEntity {
+public:
+    int64_t id = 0;
+    std::string name;
+    ZENIX_ENTITY(Customer, id, name)
+};
+
+class Order : public IEntity {
+public:
+    int64_t id = 0;
+    std::string name;
+    int64_t customer_id = 0;
+    ZENIX_ENTITY(Order, id, name, customer_id)
+};
+
+std::string customerName(const std::shared_ptr<IEntity>& order) {
+    auto customer = order->relation("customer").getOne();
+    return customer ? std::static_pointer_cast<Customer>(customer)->name : "(null)";
+}
+
+} // namespace
+
+int main() {
+    const char* database = "fetch_join_test.db";
+    std::remove(database);
+
+    EntityMapper::getInstance().registerEntity(EntityReflection::makeMapping<Customer>("customers"));
+    EntityMapping orderMapping = EntityReflection::makeMapping<Order>("orders");
+    orderMapping.relationships.push_back(Relationship{"customer", "ManyToOne", "Customer", "", "customer_id"});
+    EntityMapper::getInstance().registerEntity(orderMapping);
+
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    SessionFactory::getInstance().configure(config);
+    auto session = SessionFactory::getInstance().openSession();
+
+    // 두 테이블 모두 id, name 컬럼을 가집니다.
+    session->createQuery("CREATE TABLE customers (id INTEGER PRIMARY KEY, name TEXT)")->listMap();
+    session->createQuery("CREATE TABLE orders (id INTEGER PRIMARY KEY, name TEXT, customer_id INTEGER)")->listMap();
+    session->createQuery("INSERT INTO customers VALUES (1, 'kim'), (2, 'lee')")->listMap();
+    session->createQuery("INSERT INTO orders VALUES (1, 'a', 1), (2, 'b', 1), (3, 'c', 2), (4, 'd', NULL)")->listMap();
+
+    // 한정되지 않은 where/orderBy 컬럼은 루트 테이블을 가리킵니다.
+    auto builder = session->createQueryBuilder();
+    builder->select("*").from("orders").where("id >= :min").where("name <> 'c'").orderBy("id", "DESC").fetchJoin("customer");
+    auto query = builder->getQuery();
+    query->setParameter("min", 2);
+    auto orders = query->list();
+    check(orders.size() == 2, "where with unqualified columns");
+    if (orders.size() == 2) {
+        check(std::static_pointer_cast<Order>(orders[0])->id == 4, "orderBy id DESC");
+        check(customerName(orders[0]) == "(null)", "LEFT JOIN without a match");
+        check(std::static_pointer_cast<Order>(orders[1])->name == "b", "root column not overwritten by joined column");
+        check(customerName(orders[1]) == "kim", "joined entity");
+    }
+
+    // 별칭과 조인 대상 컬럼 조건
+    auto aliased = session->createQueryBuilder();
+    aliased->select("*").from("orders", "o").where("zj0.zj0__name = 'kim'").orderBy("o.id").fetchJoin("customer");
+    auto kimOrders = aliased->getQuery()->list();
+    check(kimOrders.size() == 2, "condition on joined column");
+    if (kimOrders.size() == 2) {
+        check(kimOrders[0]->relation("customer").getOne() == kimOrders[1]->relation("customer").getOne(),
+              "related entity deduplicated");
+    }
+
+    session->close();
+    std::remove(database);
+    if (failures == 0) {
+        std::cout << "FetchJoinTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
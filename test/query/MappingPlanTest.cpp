@@ -0,0 +1,87 @@
+// MappingPlan 및 Query::list 결과 매핑 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "include/mapping/EntityReflection.h"
+#include "core/SessionFactory.h"
+#include "core/Session.h"
+#include "query/MappingPlan.h"
+#include <cstdio>
+#include <iostream>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+class Item : public IEntity {
+public:
+    int64_t id = 0;
+    std::string name;
+    double price = 0.0;
+    ZENIX_ENTITY(Item, id, name, price)
+};
+
+std::shared_ptr<Item> asItem(const std::shared_ptr<IEntity>& entity) {
+    return std::static_pointer_cast<Item>(entity);
+}
+
+} // namespace
+
+int main() {
+    const char* database = "mapping_plan_test.db";
+    std::remove(database);
+
+    EntityMapping mapping = EntityReflection::makeMapping<Item>("items");
+    EntityMapper::getInstance().registerEntity(mapping);
+
+    // 이름만으로 만든 계획: ID, 필드, 알 수 없는 컬럼
+    auto plan = MappingPlan::forColumns(EntityMapper::getInstance().getMapping("Item"), {"price", "id", "other"});
+    check(plan->columns.size() == 3, "one plan column per result column");
+    check(plan->columns[0].target == MappingPlan::Target::Field && plan->columns[0].field->columnName == "price",
+          "field column");
+    check(plan->columns[1].target == MappingPlan::Target::Id, "id column");
+    check(plan->columns[2].target == MappingPlan::Target::Skip, "unknown column skipped");
+
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    SessionFactory::getInstance().configure(config);
+    auto session = SessionFactory::getInstance().openSession();
+    session->createQuery("CREATE TABLE items (id INTEGER PRIMARY KEY, name TEXT, price REAL)")->listMap();
+    session->createQuery("INSERT INTO items VALUES (1, 'pen', 1.5), (2, 'ink', 3)")->listMap();
+
+    // 컬럼 순서와 추가 컬럼에 관계없이 매핑하고, 같은 문을 다시 실행할 때 캐시된 계획을 사용합니다.
+    for (int run = 0; run < 2; ++run) {
+        auto items = session->createQuery("SELECT price, 1 AS extra, name, id FROM items ORDER BY id")->list();
+        check(items.size() == 2, "list rows");
+        if (items.size() == 2) {
+            check(asItem(items[0])->id == 1 && asItem(items[0])->name == "pen", "reordered columns");
+            check(asItem(items[1])->price == 3.0, "integer stored in REAL column");
+        }
+    }
+
+#ifdef SQLITE_ENABLE_COLUMN_METADATA
+    // 별칭이 붙은 컬럼은 원본 컬럼 이름으로 매핑합니다.
+    auto aliased = session->createQuery("SELECT id, name AS label FROM items WHERE id = 1")->list();
+    check(aliased.size() == 1 && asItem(aliased[0])->name == "pen", "aliased column");
+#endif
+
+    // 매핑을 다시 등록하면 이전 계획을 쓰지 않습니다.
+    EntityMapping reduced = mapping;
+    reduced.fields.erase(reduced.fields.begin()); // name 제외
+    EntityMapper::getInstance().registerEntity(reduced);
+    auto items = session->createQuery("SELECT price, 1 AS extra, name, id FROM items ORDER BY id")->list();
+    check(items.size() == 2 && asItem(items[0])->name.empty() && asItem(items[0])->price == 1.5,
+          "plan rebuilt after re-registration");
+
+    session->close();
+    std::remove(database);
+    if (failures == 0) {
+        std::cout << "MappingPlanTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,104 @@
+// 타입별 파라미터 바인딩 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "core/SessionFactory.h"
+#include "core/Session.h"
+#include "ORMException/DataAccessException/QueryExecutionException/QueryExecutionException.h"
+#include "ORMException/InvalidParameterException/InvalidParameterException.h"
+#include <cstdio>
+#include <iostream>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+} // namespace
+
+int main() {
+    const char* database = "parameter_binding_test.db";
+    std::remove(database);
+
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    SessionFactory::getInstance().configure(config);
+    auto session = SessionFactory::getInstance().openSession();
+
+    // 값의 타입이 SQLite 저장 타입으로 그대로 전달됩니다.
+    auto typed = session->createQuery("SELECT typeof(:i), typeof(:r), typeof(:t), typeof(:b), typeof(:n), typeof(:f)");
+    typed->setParameter("i", 42);
+    typed->setParameter("r", 2.5);
+    typed->setParameter("t", "text");
+    typed->setParameter("b", Blob{1, 2, 3});
+    typed->setParameter("n", nullptr);
+    typed->setParameter("f", true);
+    ResultSet types = typed->listMap();
+    check(types.getString(0, 0) == "integer" && types.getString(0, 1) == "real", "numeric types");
+    check(types.getString(0, 2) == "text" && types.getString(0, 3) == "blob", "text and blob types");
+    check(types.getString(0, 4) == "null" && types.getString(0, 5) == "integer", "null and bool");
+
+    // 길이 0인 문자열/BLOB은 NULL이 아닌 빈 값으로 바인딩됩니다.
+    auto empty = session->createQuery("SELECT typeof(:a), typeof(:b), typeof(:c), typeof(:d)");
+    empty->setParameter("a", Blob{});
+    empty->setParameter("b", std::string_view());
+    empty->setParameter("c", BlobView{nullptr, 0});
+    empty->setParameter("d", std::string());
+    ResultSet emptyTypes = empty->listMap();
+    check(emptyTypes.getString(0, 0) == "blob" && emptyTypes.getString(0, 2) == "blob", "empty blob");
+    check(emptyTypes.getString(0, 1) == "text" && emptyTypes.getString(0, 3) == "text", "empty text");
+
+    // 복사 없이 바인딩한 값 (실행이 끝날 때까지 유지)
+    std::string owned = "zero-copy";
+    const char bytes[] = {'a', '\0', 'b'};
+    auto views = session->createQuery("SELECT :s, length(:v)");
+    views->setParameter("s", std::string_view(owned));
+    views->setParameter("v", BlobView{bytes, sizeof(bytes)});
+    ResultSet viewed = views->listMap();
+    check(viewed.getString(0, 0) == "zero-copy" && viewed.getInt64(0, 1) == 3, "string_view and BlobView");
+
+    // 같은 이름은 여러 번 참조할 수 있고, 다시 설정하면 새 값으로 실행합니다.
+    auto repeated = session->createQuery("SELECT :x + :x");
+    repeated->setParameter("x", 2);
+    check(repeated->listMap().getInt64(0, 0) == 4, "repeated parameter");
+    repeated->setParameter("x", 5);
+    check(repeated->listMap().getInt64(0, 0) == 10, "parameter replaced");
+
+    // 설정하지 않은 파라미터와 이름 없는 파라미터는 실행 전에 실패합니다.
+    bool missing = false;
+    try {
+        session->createQuery("SELECT :unset")->listMap();
+    } catch (const QueryExecutionException&) {
+        missing = true;
+    }
+    check(missing, "unset parameter");
+    bool unnamed = false;
+    try {
+        session->createQuery("SELECT ?")->listMap();
+    } catch (const QueryExecutionException&) {
+        unnamed = true;
+    }
+    check(unnamed, "unnamed parameter");
+
+    // std::any 값 변환
+    check(std::get<int64_t>(toSQLParameter(std::any(7))) == 7, "int from any");
+    check(std::get<std::string>(toSQLParameter(std::any(std::string("s")))) == "s", "string from any");
+    bool unsupported = false;
+    try {
+        toSQLParameter(std::any(std::vector<int>{1}));
+    } catch (const InvalidParameterException&) {
+        unsupported = true;
+    }
+    check(unsupported, "unsupported any type");
+
+    session->close();
+    std::remove(database);
+    if (failures == 0) {
+        std::cout << "ParameterBindingTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
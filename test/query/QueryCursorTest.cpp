@@ -0,0 +1,111 @@
+// IQuery::stream 커서 테스트
+// 라이브러리 소스(src/)와 함께 C++17로 빌드하고 sqlite3를 링크해 실행합니다. 실패하면 1을 반환합니다.
+#include "include/mapping/EntityReflection.h"
+#include "core/SessionFactory.h"
+#include "core/Session.h"
+#include "ORMException/DataAccessException/LockAcquisitionException/LockAcqusitionException.h"
+#include "ORMException/DataAccessException/QueryExecutionException/QueryExecutionException.h"
+#include <sqlite3.h>
+#include <cstdio>
+#include <iostream>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAILED: " << message << std::endl;
+        ++failures;
+    }
+}
+
+class Item : public IEntity {
+public:
+    int64_t id = 0;
+    std::string name;
+    ZENIX_ENTITY(Item, id, name)
+};
+
+} // namespace
+
+int main() {
+    const char* database = "query_cursor_test.db";
+    std::remove(database);
+
+    EntityMapper::getInstance().registerEntity(EntityReflection::makeMapping<Item>("items"));
+
+    DatabaseConfig config;
+    config.setDatabaseName(database);
+    RetryPolicy retryPolicy;
+    retryPolicy.maxAttempts = 3;
+    retryPolicy.initialBackoff = std::chrono::milliseconds(1);
+    config.setRetryPolicy(retryPolicy);
+    SessionFactory::getInstance().configure(config);
+
+    auto session = SessionFactory::getInstance().openSession();
+    session->createQuery("CREATE TABLE items (id INTEGER PRIMARY KEY, name TEXT)")->listMap();
+    session->createQuery("INSERT INTO items VALUES (1, 'a'), (2, 'b'), (3, 'c')")->listMap();
+
+    // 한 행씩 읽고 엔티티로 변환
+    auto cursor = session->createQuery("SELECT * FROM items ORDER BY id")->stream();
+    size_t rows = 0;
+    std::string names;
+    while (cursor->next()) {
+        ++rows;
+        names += std::static_pointer_cast<Item>(cursor->getEntity())->name;
+    }
+    check(rows == 3 && names == "abc", "stream all rows");
+    check(!cursor->next(), "exhausted cursor stays at end");
+
+    // 조기 종료 후 같은 문을 다시 사용할 수 있습니다.
+    auto early = session->createQuery("SELECT * FROM items ORDER BY id")->stream();
+    check(early->next() && early->getInt64(0) == 1, "first row");
+    early->close();
+    check(!early->next(), "closed cursor");
+    check(session->createQuery("SELECT * FROM items ORDER BY id")->list().size() == 3, "statement reused after close");
+
+    // 세션이 닫히면 열린 커서도 닫히고 이후 사용은 실패합니다.
+    auto open = session->createQuery("SELECT id FROM items")->stream();
+    check(open->next(), "open cursor row");
+    session->close();
+    bool rejected = false;
+    try {
+        open->next();
+    } catch (const QueryExecutionException&) {
+        rejected = true;
+    }
+    check(rejected, "cursor invalidated by Session::close");
+
+    // 잠금 경합으로 첫 step이 실패하면 재시도 횟수를 함께 알립니다.
+    auto other = SessionFactory::getInstance().openSession();
+    sqlite3* locker = nullptr;
+    sqlite3_open(database, &locker);
+    sqlite3_exec(locker, "BEGIN EXCLUSIVE", nullptr, nullptr, nullptr);
+    auto blocked = other->createQuery("SELECT id FROM items")->stream();
+    size_t retries = 0;
+    bool lockFailed = false;
+    try {
+        blocked->next();
+    } catch (const LockAcquisitionException& e) {
+        lockFailed = true;
+        retries = e.getRetryCount();
+    }
+    check(lockFailed && retries == retryPolicy.maxAttempts - 1, "lock error reports retry count");
+    sqlite3_exec(locker, "ROLLBACK", nullptr, nullptr, nullptr);
+    sqlite3_close(locker);
+
+    auto retried = other->createQuery("SELECT id FROM items")->stream();
+    rows = 0;
+    while (retried->next()) {
+        ++rows;
+    }
+    check(rows == 3, "cursor works after lock released");
+    other->close();
+
+    std::remove(database);
+    if (failures == 0) {
+        std::cout << "QueryCursorTest passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}